@@ -985,26 +985,22 @@ static void move_item( player &p, item &it, const int quantity, const tripoint &
 
 std::vector<tripoint> route_adjacent( const player &p, const tripoint &dest )
 {
-    auto passable_tiles = std::unordered_set<tripoint>();
+    std::vector<tripoint> passable_tiles;
 
     for( const tripoint &tp : g->m.points_in_radius( dest, 1 ) ) {
         if( tp != p.pos() && g->m.passable( tp ) ) {
-            passable_tiles.emplace( tp );
+            passable_tiles.push_back( tp );
         }
     }
 
-    const auto &sorted = get_sorted_tiles_by_distance( p.pos(), passable_tiles );
-
-    const auto &avoid = p.get_path_avoid();
-    for( const tripoint &tp : sorted ) {
-        auto route = g->m.route( p.pos(), tp, p.get_pathfinding_settings(), avoid );
-
-        if( !route.empty() ) {
-            return route;
-        }
+    // One search for all of them, the first route found is the cheapest one
+    std::vector<std::vector<tripoint>> routes = g->m.routes( p.pos(), passable_tiles,
+            p.get_pathfinding_settings(), 1, p.get_path_avoid() );
+    if( routes.empty() ) {
+        return std::vector<tripoint>();
     }
 
-    return std::vector<tripoint>();
+    return std::move( routes.front() );
 }
 
 static activity_reason_info find_base_construction(
@@ -1,6 +1,7 @@
 #include "behavior.h"
 
 #include <assert.h>
+#include <algorithm>
 #include <list>
 #include <set>
 #include <unordered_map>
@@ -21,6 +22,8 @@ void node_t::set_strategy( const strategy_t *new_strategy )
 void node_t::set_predicate( std::function<status_t ( const oracle_t * )> new_predicate )
 {
     predicate = new_predicate;
+    default_predicate = false;
+    predicate_source = nullptr;
 }
 void node_t::set_goal( const std::string &new_goal )
 {
@@ -54,11 +57,63 @@ std::string node_t::goal() const
 
 std::string tree::tick( const oracle_t *subject )
 {
-    behavior_return result = root->tick( subject );
+    std::fill( predicate_results.begin(), predicate_results.end(), -1 );
+    behavior_return result = evaluate( 0, subject );
     active_node = result.result == running ? result.selection : nullptr;
     return goal();
 }
 
+// Same as node_t::tick, on the compiled nodes.
+behavior_return tree::evaluate( const size_t index, const oracle_t *subject )
+{
+    const compiled_node &node = nodes[index];
+    status_t result = running;
+    if( node.predicate >= 0 ) {
+        int &cached = predicate_results[node.predicate];
+        if( cached < 0 ) {
+            cached = ( *predicates[node.predicate] )( subject );
+        }
+        result = static_cast<status_t>( cached );
+    }
+    if( node.strategy == nullptr ) {
+        return { result, node.source };
+    }
+    if( result != running ) {
+        return { result, nullptr };
+    }
+    for( size_t child = index + 1; child < node.end; child = nodes[child].end ) {
+        const behavior_return outcome = evaluate( child, subject );
+        if( node.strategy->stops_at( outcome.result ) ) {
+            return outcome;
+        }
+    }
+    return { node.strategy->exhausted(), nullptr };
+}
+
+void tree::compile( const node_t &node )
+{
+    const size_t index = nodes.size();
+    nodes.push_back( { &node, node.children.empty() ? nullptr : node.strategy, -1, 0 } );
+    assert( node.predicate );
+    assert( node.children.empty() || node.strategy != nullptr );
+    if( !node.default_predicate ) {
+        const auto shared = node.predicate_source == nullptr ? predicate_sources.end() :
+                            std::find( predicate_sources.begin(), predicate_sources.end(),
+                                       node.predicate_source );
+        if( shared != predicate_sources.end() ) {
+            nodes[index].predicate = shared - predicate_sources.begin();
+        } else {
+            nodes[index].predicate = predicates.size();
+            predicates.push_back( &node.predicate );
+            predicate_sources.push_back( node.predicate_source );
+        }
+    }
+    for( const node_t *child : node.children ) {
+        compile( *child );
+    }
+    nodes[index].end = nodes.size();
+}
+
 std::string tree::goal() const
 {
     return active_node == nullptr ? "idle" : active_node->goal();
@@ -67,6 +122,12 @@ std::string tree::goal() const
 void tree::add( const node_t *new_node )
 {
     root = new_node;
+    active_node = nullptr;
+    nodes.clear();
+    predicates.clear();
+    predicate_sources.clear();
+    compile( *root );
+    predicate_results.assign( predicates.size(), -1 );
 }
 
 // Now for the generic_factory definition
@@ -124,6 +185,8 @@ void node_t::load( JsonObject &jo, const std::string & )
         auto new_predicate = predicate_map.find( jo.get_string( "predicate" ) );
         if( new_predicate != predicate_map.end() ) {
             predicate = new_predicate->second;
+            default_predicate = false;
+            predicate_source = &new_predicate->second;
         } else {
             debugmsg( "While loading %s, failed to find predicate %s.",
                       id.str(), jo.get_string( "predicate" ) );
@@ -38,6 +38,8 @@ struct behavior_return {
 // nodes in order of descending priority.
 // A predicate can be injected into any node to direct iteration,
 // including skipping entire subtrees.
+// When the root is set, the tree is compiled into a flat array of nodes in depth-first order,
+// so later changes to the nodes themselves aren't picked up.
 class tree
 {
     public:
@@ -48,8 +50,26 @@ class tree
         // Set the root node of the tree.
         void add( const node_t *new_node );
     private:
+        struct compiled_node {
+            const node_t *source;
+            // How to visit the children, null for leaves.
+            const strategy_t *strategy;
+            // Index into predicates, or -1 for the default predicate that always returns running.
+            int predicate;
+            // Index one past the last node of this subtree, the children are in between.
+            size_t end;
+        };
+        void compile( const node_t &node );
+        behavior_return evaluate( size_t index, const oracle_t *subject );
+
         const node_t *root = nullptr;
         const node_t *active_node = nullptr;
+        std::vector<compiled_node> nodes;
+        // Each distinct predicate once, so a tick never evaluates one of them twice.
+        std::vector<const std::function<status_t( const oracle_t * )> *> predicates;
+        std::vector<const void *> predicate_sources;
+        // Results of predicates during the current tick, unknown ones are -1.
+        std::vector<int> predicate_results;
 };
 
 class node_t
@@ -72,9 +92,14 @@ class node_t
         string_id<node_t> id;
         bool was_loaded = false;
     private:
+        friend class tree;
         std::vector<const node_t *> children;
         const strategy_t *strategy;
         std::function<status_t( const oracle_t * )> predicate;
+        // Whether predicate is still the default one, which always returns running.
+        bool default_predicate = true;
+        // The predicate_map entry predicate came from, so nodes sharing it can share results.
+        const void *predicate_source = nullptr;
         // TODO: make into an ID?
         std::string _goal;
 };
@@ -20,41 +20,47 @@ std::unordered_map<std::string, const strategy_t *> strategy_map = {{
 
 using namespace behavior;
 
-// A standard behavior strategy, execute runnable children in order unless one fails.
-behavior_return sequential_t::evaluate( const oracle_t *subject,
-                                        const std::vector<const node_t *> children ) const
+behavior_return strategy_t::evaluate( const oracle_t *subject,
+                                      const std::vector<const node_t *> &children ) const
 {
     for( const node_t *child : children ) {
         behavior_return outcome = child->tick( subject );
-        if( outcome.result == running || outcome.result == failure ) {
+        if( stops_at( outcome.result ) ) {
             return outcome;
         }
     }
-    return { success, nullptr };
+    return { exhausted(), nullptr };
+}
+
+// A standard behavior strategy, execute runnable children in order unless one fails.
+bool sequential_t::stops_at( const status_t result ) const
+{
+    return result == running || result == failure;
+}
+
+status_t sequential_t::exhausted() const
+{
+    return success;
 }
 
 // A standard behavior strategy, execute runnable children in order until one succeeds.
-behavior_return fallback_t::evaluate( const oracle_t *subject,
-                                      const std::vector<const node_t *> children ) const
+bool fallback_t::stops_at( const status_t result ) const
 {
-    for( const node_t *child : children ) {
-        behavior_return outcome = child->tick( subject );
-        if( outcome.result == running || outcome.result == success ) {
-            return outcome;
-        }
-    }
-    return { failure, nullptr };
+    return result == running || result == success;
+}
+
+status_t fallback_t::exhausted() const
+{
+    return failure;
 }
 
 // A non-standard behavior strategy, execute runnable children in order unconditionally.
-behavior_return sequential_until_done_t::evaluate( const oracle_t *subject,
-        const std::vector<const node_t *> children ) const
+bool sequential_until_done_t::stops_at( const status_t result ) const
 {
-    for( const node_t *child : children ) {
-        behavior_return outcome = child->tick( subject );
-        if( outcome.result == running ) {
-            return outcome;
-        }
-    }
-    return { success, nullptr };
+    return result == running;
+}
+
+status_t sequential_until_done_t::exhausted() const
+{
+    return success;
 }
@@ -15,29 +15,34 @@ class oracle_t;
 enum status_t : char;
 struct behavior_return;
 
+// A strategy visits children in order until one of them returns a result it stops at.
 class strategy_t
 {
     public:
-        virtual behavior_return evaluate( const oracle_t *subject,
-                                          std::vector<const node_t *> children ) const = 0;
+        behavior_return evaluate( const oracle_t *subject,
+                                  const std::vector<const node_t *> &children ) const;
+        // Whether to stop visiting children after one of them returned result.
+        virtual bool stops_at( status_t result ) const = 0;
+        // What to return when no child returned a result to stop at.
+        virtual status_t exhausted() const = 0;
 };
 
 class sequential_t : public strategy_t
 {
-        behavior_return evaluate( const oracle_t *subject,
-                                  std::vector<const node_t *> children ) const override;
+        bool stops_at( status_t result ) const override;
+        status_t exhausted() const override;
 };
 
 class fallback_t : public strategy_t
 {
-        behavior_return evaluate( const oracle_t *subject,
-                                  std::vector<const node_t *> children ) const override;
+        bool stops_at( status_t result ) const override;
+        status_t exhausted() const override;
 };
 
 class sequential_until_done_t : public strategy_t
 {
-        behavior_return evaluate( const oracle_t *subject,
-                                  std::vector<const node_t *> children ) const override;
+        bool stops_at( status_t result ) const override;
+        status_t exhausted() const override;
 };
 
 extern std::unordered_map<std::string, const strategy_t *> strategy_map;
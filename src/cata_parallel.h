@@ -0,0 +1,44 @@
+#pragma once
+#ifndef CATA_PARALLEL_H
+#define CATA_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+/**
+ * Calls @p work( begin, end ) for consecutive slices that together cover [0, count).
+ * The slices are spread over worker threads, with the calling thread doing the first
+ * one, and all of them are done when this returns.
+ * No threads are started unless there are at least @p min_items_per_thread items for
+ * each of them, and never more than the hardware has.
+ * Each index belongs to exactly one slice, so results written per index don't depend
+ * on the number of threads. @p work must only read state shared between slices.
+ */
+template<typename Work>
+void parallel_slices( const size_t count, const size_t min_items_per_thread, const Work &work )
+{
+    const size_t hardware = std::max( std::thread::hardware_concurrency(), 1u );
+    const size_t threads = std::min( hardware,
+                                     count / std::max<size_t>( min_items_per_thread, 1 ) );
+    if( threads <= 1 ) {
+        work( size_t( 0 ), count );
+        return;
+    }
+    const size_t per_thread = ( count + threads - 1 ) / threads;
+    std::vector<std::thread> workers;
+    for( size_t begin = per_thread; begin < count; begin += per_thread ) {
+        workers.emplace_back( work, begin, std::min( begin + per_thread, count ) );
+    }
+    work( size_t( 0 ), std::min( per_thread, count ) );
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+}
+
+#endif
@@ -3,6 +3,7 @@
 #define CATA_CHARACTER_ID_H
 
 #include <cassert>
+#include <functional>
 #include <ostream>
 
 class JsonIn;
@@ -55,4 +56,14 @@ inline std::ostream &operator<<( std::ostream &o, character_id id )
     return o << id.get_value();
 }
 
+namespace std
+{
+template <>
+struct hash<character_id> {
+    std::size_t operator()( const character_id &id ) const {
+        return std::hash<int>()( id.get_value() );
+    }
+};
+} // namespace std
+
 #endif // CATA_CHARACTER_ID_H
@@ -56,16 +56,10 @@ void read_condition( JsonObject &jo, const std::string &member_name,
         condition = null_function;
     } else if( jo.has_string( member_name ) ) {
         const std::string type = jo.get_string( member_name );
-        conditional_t<T> sub_condition( type );
-        condition = [sub_condition]( const T & d ) {
-            return sub_condition( d );
-        };
+        condition = std::move( conditional_t<T>( type ).condition );
     } else if( jo.has_object( member_name ) ) {
         JsonObject con_obj = jo.get_object( member_name );
-        conditional_t<T> sub_condition( con_obj );
-        condition = [sub_condition]( const T & d ) {
-            return sub_condition( d );
-        };
+        condition = std::move( conditional_t<T>( con_obj ).condition );
     } else {
         jo.throw_error( "invalid condition syntax", member_name );
     }
@@ -882,25 +876,32 @@ conditional_t<T>::conditional_t( JsonObject &jo )
     // improve the clarity of NPC setter functions
     const bool is_npc = true;
     bool found_sub_member = false;
-    const auto parse_array = []( JsonObject jo, const std::string & type ) {
-        std::vector<conditional_t> conditionals;
+    // Nested "and" in "and" (or "or" in "or") is merged into one flat list of terms, so
+    // evaluating a condition doesn't have to go through a chain of wrappers.
+    using term_t = std::function<bool( const T & )>;
+    std::function<void( JsonObject, const std::string &, std::vector<term_t> & )> parse_array;
+    parse_array = [&parse_array]( JsonObject jo, const std::string & type,
+    std::vector<term_t> &terms ) {
         JsonArray ja = jo.get_array( type );
         while( ja.has_more() ) {
             if( ja.test_string() ) {
-                conditional_t<T> type_condition( ja.next_string() );
-                conditionals.emplace_back( type_condition );
+                terms.emplace_back( std::move( conditional_t<T>( ja.next_string() ).condition ) );
             } else if( ja.test_object() ) {
                 JsonObject cond = ja.next_object();
-                conditional_t<T> type_condition( cond );
-                conditionals.emplace_back( type_condition );
+                // "and" takes precedence when an object has both
+                if( cond.has_array( type ) && ( type == "and" || !cond.has_array( "and" ) ) ) {
+                    parse_array( cond, type, terms );
+                } else {
+                    terms.emplace_back( std::move( conditional_t<T>( cond ).condition ) );
+                }
             } else {
                 ja.skip_value();
             }
         }
-        return conditionals;
     };
     if( jo.has_array( "and" ) ) {
-        std::vector<conditional_t> and_conditionals = parse_array( jo, "and" );
+        std::vector<term_t> and_conditionals;
+        parse_array( jo, "and", and_conditionals );
         found_sub_member = true;
         condition = [and_conditionals]( const T & d ) {
             for( const auto &cond : and_conditionals ) {
@@ -911,7 +912,8 @@ conditional_t<T>::conditional_t( JsonObject &jo )
             return true;
         };
     } else if( jo.has_array( "or" ) ) {
-        std::vector<conditional_t> or_conditionals = parse_array( jo, "or" );
+        std::vector<term_t> or_conditionals;
+        parse_array( jo, "or", or_conditionals );
         found_sub_member = true;
         condition = [or_conditionals]( const T & d ) {
             for( const auto &cond : or_conditionals ) {
@@ -923,13 +925,13 @@ conditional_t<T>::conditional_t( JsonObject &jo )
         };
     } else if( jo.has_object( "not" ) ) {
         JsonObject cond = jo.get_object( "not" );
-        const conditional_t<T> sub_condition = conditional_t<T>( cond );
+        const term_t sub_condition = conditional_t<T>( cond ).condition;
         found_sub_member = true;
         condition = [sub_condition]( const T & d ) {
             return !sub_condition( d );
         };
     } else if( jo.has_string( "not" ) ) {
-        const conditional_t<T> sub_condition = conditional_t<T>( jo.get_string( "not" ) );
+        const term_t sub_condition = conditional_t<T>( jo.get_string( "not" ) ).condition;
         found_sub_member = true;
         condition = [sub_condition]( const T & d ) {
             return !sub_condition( d );
@@ -1056,10 +1058,7 @@ conditional_t<T>::conditional_t( JsonObject &jo )
     } else {
         for( const std::string &sub_member : dialogue_data::simple_string_conds ) {
             if( jo.has_string( sub_member ) ) {
-                const conditional_t<T> sub_condition( jo.get_string( sub_member ) );
-                condition = [sub_condition]( const T & d ) {
-                    return sub_condition( d );
-                };
+                condition = std::move( conditional_t<T>( jo.get_string( sub_member ) ).condition );
                 found_sub_member = true;
                 break;
             }
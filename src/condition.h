@@ -67,6 +67,10 @@ struct conditional_t {
     private:
         std::function<bool( const T & )> condition;
 
+        // Takes the loaded function directly instead of wrapping this object.
+        friend void read_condition<T>( JsonObject &jo, const std::string &member_name,
+                                       std::function<bool( const T & )> &condition, bool default_val );
+
     public:
         conditional_t() = default;
         conditional_t( const std::string &type );
@@ -1022,6 +1022,7 @@ void Creature::add_effect( const efftype_id &eff_id, const time_duration dur, bo
             e.set_intensity( e.get_max_intensity() );
         }
         ( *effects )[eff_id][bp] = e;
+        effects->update_type( eff_id );
         if( Character *ch = as_character() ) {
             g->events().send<event_type::character_gains_effect>( ch->getID(), eff_id );
             if( is_player() && !type.get_apply_message().empty() ) {
@@ -1093,13 +1094,17 @@ bool Creature::remove_effect( const efftype_id &eff_id, body_part bp )
             effects->erase( eff_id );
         }
     }
+    effects->update_type( eff_id );
     return true;
 }
 bool Creature::has_effect( const efftype_id &eff_id, body_part bp ) const
 {
+    if( !effects->has_type( effect_type_index( eff_id ) ) ) {
+        return false;
+    }
     // num_bp means anything targeted or not
     if( bp == num_bp ) {
-        return effects->find( eff_id ) != effects->end();
+        return true;
     } else {
         auto got_outer = effects->find( eff_id );
         if( got_outer != effects->end() ) {
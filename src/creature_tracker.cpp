@@ -30,6 +30,132 @@ std::shared_ptr<monster> Creature_tracker::find( const tripoint &pos ) const
     return nullptr;
 }
 
+static bool in_location_grid( const tripoint &pos )
+{
+    return pos.x >= 0 && pos.y >= 0 && pos.x < MAPSIZE_X && pos.y < MAPSIZE_Y &&
+           pos.z >= -OVERMAP_DEPTH && pos.z <= OVERMAP_HEIGHT;
+}
+
+static int bucket_index( const point &p )
+{
+    return ( p.x / SEEX ) * MAPSIZE + p.y / SEEY;
+}
+
+monster *Creature_tracker::find_unowned( const tripoint &pos ) const
+{
+    if( !in_location_grid( pos ) ) {
+        return find( pos ).get();
+    }
+    const std::vector<monster *> &grid = location_layers[pos.z + OVERMAP_DEPTH].grid;
+    if( grid.empty() ) {
+        return nullptr;
+    }
+    monster *const critter = grid[pos.x * MAPSIZE_Y + pos.y];
+    if( critter != nullptr && !critter->is_dead() ) {
+        return critter;
+    }
+    return nullptr;
+}
+
+std::vector<monster *> Creature_tracker::monsters_in_rect( const tripoint &min,
+        const tripoint &max ) const
+{
+    std::vector<monster *> result;
+    const tripoint lo( std::max( min.x, 0 ), std::max( min.y, 0 ), std::max( min.z, -OVERMAP_DEPTH ) );
+    const tripoint hi( std::min( max.x, MAPSIZE_X - 1 ), std::min( max.y, MAPSIZE_Y - 1 ),
+                       std::min( max.z, OVERMAP_HEIGHT ) );
+    if( lo.x > hi.x || lo.y > hi.y ) {
+        return result;
+    }
+    for( int z = lo.z; z <= hi.z; ++z ) {
+        const location_layer &layer = location_layers[z + OVERMAP_DEPTH];
+        if( layer.buckets.empty() ) {
+            continue;
+        }
+        for( int bx = lo.x / SEEX; bx <= hi.x / SEEX; ++bx ) {
+            for( int by = lo.y / SEEY; by <= hi.y / SEEY; ++by ) {
+                for( monster *const critter : layer.buckets[bx * MAPSIZE + by] ) {
+                    const tripoint &p = critter->pos();
+                    if( p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y &&
+                        !critter->is_dead() ) {
+                        result.push_back( critter );
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<monster *> Creature_tracker::monsters_in_radius( const tripoint &center,
+        const int radius, const int radiusz ) const
+{
+    return monsters_in_rect( center - tripoint( radius, radius, radiusz ),
+                             center + tripoint( radius, radius, radiusz ) );
+}
+
+Creature_tracker::location_layer *Creature_tracker::layer_at( const tripoint &pos,
+        const bool allocate )
+{
+    if( !in_location_grid( pos ) ) {
+        return nullptr;
+    }
+    location_layer &layer = location_layers[pos.z + OVERMAP_DEPTH];
+    if( layer.grid.empty() ) {
+        if( !allocate ) {
+            return nullptr;
+        }
+        layer.grid.resize( MAPSIZE_X * MAPSIZE_Y, nullptr );
+        layer.buckets.resize( MAPSIZE * MAPSIZE );
+    }
+    return &layer;
+}
+
+static void remove_from_bucket( std::vector<monster *> &bucket, const monster *critter )
+{
+    const auto iter = std::find( bucket.begin(), bucket.end(), critter );
+    if( iter != bucket.end() ) {
+        bucket.erase( iter );
+    }
+}
+
+void Creature_tracker::set_location( const tripoint &pos, const std::shared_ptr<monster> &critter )
+{
+    monsters_by_location[pos] = critter;
+    if( location_layer *const layer = layer_at( pos, true ) ) {
+        monster *&slot = layer->grid[pos.x * MAPSIZE_Y + pos.y];
+        std::vector<monster *> &bucket = layer->buckets[bucket_index( pos.xy() )];
+        if( slot != nullptr ) {
+            remove_from_bucket( bucket, slot );
+        }
+        slot = critter.get();
+        bucket.push_back( slot );
+    }
+}
+
+void Creature_tracker::erase_location( const tripoint &pos )
+{
+    monsters_by_location.erase( pos );
+    if( location_layer *const layer = layer_at( pos, false ) ) {
+        monster *&slot = layer->grid[pos.x * MAPSIZE_Y + pos.y];
+        if( slot != nullptr ) {
+            remove_from_bucket( layer->buckets[bucket_index( pos.xy() )], slot );
+            slot = nullptr;
+        }
+    }
+}
+
+void Creature_tracker::clear_locations()
+{
+    monsters_by_location.clear();
+    for( location_layer &layer : location_layers ) {
+        std::fill( layer.grid.begin(), layer.grid.end(), nullptr );
+        for( std::vector<monster *> &bucket : layer.buckets ) {
+            bucket.clear();
+        }
+    }
+}
+
 int Creature_tracker::temporary_id( const monster &critter ) const
 {
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
@@ -84,23 +210,59 @@ bool Creature_tracker::add( std::shared_ptr<monster> critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos()] = critter_ptr;
-    add_to_faction_map( critter_ptr );
+    set_location( critter.pos(), critter_ptr );
+    add_to_faction_map( critter );
     return true;
 }
 
-void Creature_tracker::add_to_faction_map( std::shared_ptr<monster> critter_ptr )
+mfaction_id Creature_tracker::member_faction( const monster &critter )
 {
-    assert( critter_ptr );
-    monster &critter = *critter_ptr;
-
     // Only 1 faction per mon at the moment.
     if( critter.friendly == 0 ) {
-        monster_faction_map_[ critter.faction ].insert( critter_ptr );
-    } else {
-        static const mfaction_str_id playerfaction( "player" );
-        monster_faction_map_[ playerfaction ].insert( critter_ptr );
+        return critter.faction;
+    }
+    static const mfaction_str_id playerfaction( "player" );
+    return playerfaction.id();
+}
+
+void Creature_tracker::add_to_faction_map( monster &critter )
+{
+    const size_t faction = member_faction( critter ).to_i();
+    if( faction >= faction_members_.size() ) {
+        faction_members_.resize( faction + 1 );
+    }
+    faction_members_[faction].push_back( &critter );
+}
+
+void Creature_tracker::remove_from_faction_map( const monster &critter )
+{
+    const auto remove_from = [&critter]( std::vector<monster *> &members ) {
+        const auto iter = std::find( members.begin(), members.end(), &critter );
+        if( iter == members.end() ) {
+            return false;
+        }
+        *iter = members.back();
+        members.pop_back();
+        return true;
+    };
+    // The monster may have changed its faction since it was added, so fall back to
+    // looking through all of them.
+    const size_t faction = member_faction( critter ).to_i();
+    if( faction < faction_members_.size() && remove_from( faction_members_[faction] ) ) {
+        return;
     }
+    for( std::vector<monster *> &members : faction_members_ ) {
+        if( remove_from( members ) ) {
+            return;
+        }
+    }
+}
+
+const std::vector<monster *> &Creature_tracker::faction_members( const mfaction_id &faction ) const
+{
+    static const std::vector<monster *> empty;
+    const size_t index = faction.to_i();
+    return index < faction_members_.size() ? faction_members_[index] : empty;
 }
 
 size_t Creature_tracker::size() const
@@ -134,8 +296,8 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( critter.pos() );
-        monsters_by_location[new_pos] = *iter;
+        erase_location( critter.pos() );
+        set_location( new_pos, *iter );
         return true;
     } else {
         const tripoint &old_pos = critter.pos();
@@ -154,7 +316,7 @@ void Creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.pos() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( critter.pos() );
         return;
     }
 
@@ -165,7 +327,7 @@ void Creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        erase_location( iter->first );
     }
 }
 
@@ -180,15 +342,7 @@ void Creature_tracker::remove( const monster &critter )
         return;
     }
 
-    for( auto &pair : monster_faction_map_ ) {
-        const auto fac_iter = pair.second.find( *iter );
-        if( fac_iter != pair.second.end() ) {
-            // Need to do this manually because the shared pointer containing critter is kept valid
-            // within removed_ and so the weak pointer in monster_faction_map_ is also valid.
-            pair.second.erase( fac_iter );
-            break;
-        }
-    }
+    remove_from_faction_map( critter );
     remove_from_location_map( critter );
     removed_.push_back( *iter );
     monsters_list.erase( iter );
@@ -197,18 +351,18 @@ void Creature_tracker::remove( const monster &critter )
 void Creature_tracker::clear()
 {
     monsters_list.clear();
-    monsters_by_location.clear();
-    monster_faction_map_.clear();
+    clear_locations();
+    faction_members_.clear();
     removed_.clear();
 }
 
 void Creature_tracker::rebuild_cache()
 {
-    monsters_by_location.clear();
-    monster_faction_map_.clear();
+    clear_locations();
+    faction_members_.clear();
     for( const std::shared_ptr<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos()] = mon_ptr;
-        add_to_faction_map( mon_ptr );
+        set_location( mon_ptr->pos(), mon_ptr );
+        add_to_faction_map( *mon_ptr );
     }
 }
 
@@ -226,13 +380,17 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
     std::shared_ptr<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
     }
 
     std::shared_ptr<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+    }
+    if( first_ptr ) {
+        erase_location( first.pos() );
+    }
+    if( second_ptr ) {
+        erase_location( second.pos() );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -242,10 +400,10 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos()] = first_ptr;
+        set_location( first.pos(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos()] = second_ptr;
+        set_location( second.pos(), second_ptr );
     }
 }
 
@@ -279,6 +437,7 @@ void Creature_tracker::remove_dead()
     for( auto iter = monsters_list.begin(); iter != monsters_list.end(); ) {
         const monster &critter = **iter;
         if( critter.is_dead() ) {
+            remove_from_faction_map( critter );
             remove_from_location_map( critter );
             iter = monsters_list.erase( iter );
         } else {
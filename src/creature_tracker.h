@@ -2,12 +2,13 @@
 #ifndef CREATURE_TRACKER_H
 #define CREATURE_TRACKER_H
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
-#include <set>
 #include <vector>
 
+#include "game_constants.h"
 #include "point.h"
 #include "type_id.h"
 
@@ -18,18 +19,15 @@ class JsonOut;
 class Creature_tracker
 {
     private:
-        void add_to_faction_map( std::shared_ptr<monster> critter );
+        void add_to_faction_map( monster &critter );
+        void remove_from_faction_map( const monster &critter );
 
-        class weak_ptr_comparator
-        {
-            public:
-                bool operator()( const std::weak_ptr<monster> &lhs, const std::weak_ptr<monster> &rhs ) const {
-                    return lhs.lock().get() < rhs.lock().get();
-                }
-        };
-
-        std::unordered_map<mfaction_id, std::set<std::weak_ptr<monster>, weak_ptr_comparator>>
-                monster_faction_map_;
+        /**
+         * Monsters in the tracker grouped by faction (friendly monsters count as the
+         * "player" faction), indexed by mfaction_id. Raw pointers are fine here, because
+         * monsters are taken out of these lists whenever they leave @ref monsters_list.
+         */
+        std::vector<std::vector<monster *>> faction_members_;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -46,6 +44,25 @@ class Creature_tracker
          * Dead monsters are ignored and not returned.
          */
         std::shared_ptr<monster> find( const tripoint &pos ) const;
+        /**
+         * Same as @ref find, but returns a non-owning pointer, looked up in a dense grid
+         * over the reality bubble. Use this in hot paths that don't need to keep the
+         * monster alive.
+         */
+        monster *find_unowned( const tripoint &pos ) const;
+        /**
+         * Returns the living monsters inside the box spanned by the two corners (inclusive),
+         * clipped to the reality bubble. Only the coarse buckets overlapping the box are
+         * visited, so this is cheap for small boxes regardless of the total monster count.
+         */
+        std::vector<monster *> monsters_in_rect( const tripoint &min, const tripoint &max ) const;
+        /**
+         * Returns the living monsters within @p radius (square distance) of @p center and
+         * within @p radiusz z-levels of it. Callers that need trigdist or line of sight
+         * still have to filter the result.
+         */
+        std::vector<monster *> monsters_in_radius( const tripoint &center, int radius,
+                int radiusz = 0 ) const;
         /**
          * Returns a temporary id of the given monster (which must exist in the tracker).
          * The id is valid until monsters are added or removed from the tracker.
@@ -84,13 +101,30 @@ class Creature_tracker
         void serialize( JsonOut &jsout ) const;
         void deserialize( JsonIn &jsin );
 
-        const decltype( monster_faction_map_ ) &factions() const {
-            return monster_faction_map_;
-        }
+        /** The monsters that were in the given faction when they were added. */
+        const std::vector<monster *> &faction_members( const mfaction_id &faction ) const;
+        /** The faction @p critter is grouped under in @ref faction_members. */
+        static mfaction_id member_faction( const monster &critter );
 
     private:
         std::vector<std::shared_ptr<monster>> monsters_list;
         std::unordered_map<tripoint, std::shared_ptr<monster>> monsters_by_location;
+        /**
+         * Non-owning copy of @ref monsters_by_location for the locations inside the reality
+         * bubble, for one z-level. Both members are allocated on first use.
+         */
+        struct location_layer {
+            /** Flat MAPSIZE_X * MAPSIZE_Y array of the monster on each tile. */
+            std::vector<monster *> grid;
+            /** The same monsters, bucketed by SEEX * SEEY block, for area queries. */
+            std::vector<std::vector<monster *>> buckets;
+        };
+        /** Only ever changed together with @ref monsters_by_location. */
+        std::array<location_layer, OVERMAP_LAYERS> location_layers;
+        location_layer *layer_at( const tripoint &pos, bool allocate );
+        void set_location( const tripoint &pos, const std::shared_ptr<monster> &critter );
+        void erase_location( const tripoint &pos );
+        void clear_locations();
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
 };
@@ -368,9 +368,11 @@ class json_talk_response
         json_talk_response( JsonObject &jo );
 
         /**
-         * Callback from @ref json_talk_topic::gen_responses, see there.
+         * Callback from @ref json_talk_topic::gen_responses, whether this response is shown.
+         * Sets switch_done once a switch response that isn't the default was chosen.
          */
-        bool gen_responses( dialogue &d, bool switch_done ) const;
+        bool selected( const dialogue &d, bool &switch_done ) const;
+        const talk_response &get_response() const;
         bool gen_repeat_response( dialogue &d, const itype_id &item_id, bool switch_done ) const;
 };
 
@@ -423,7 +425,7 @@ class json_talk_topic
         void load( JsonObject &jo );
 
         std::string get_dynamic_line( const dialogue &d ) const;
-        std::vector<json_dynamic_line_effect> get_speaker_effects() const;
+        const std::vector<json_dynamic_line_effect> &get_speaker_effects() const;
 
         void check_consistency() const;
         /**
@@ -20,6 +20,15 @@
 namespace
 {
 std::map<efftype_id, effect_type> effect_types;
+/** Indexed by effect_type::index, points into effect_types */
+std::vector<const effect_type *> effect_types_by_index;
+/**
+ * Bumped whenever the effect types are reset, so indices cached in ids by an earlier
+ * load are recognizably stale. The cached cid holds the generation above the index bits.
+ */
+int effect_types_generation = 0;
+constexpr int effect_index_bits = 16;
+constexpr int effect_index_mask = ( 1 << effect_index_bits ) - 1;
 } // namespace
 
 /** @relates string_id */
@@ -42,6 +51,55 @@ bool string_id<effect_type>::is_valid() const
     return effect_types.count( *this ) > 0;
 }
 
+int effect_type_index( const efftype_id &id )
+{
+    const int cid = id.get_cid().to_i();
+    if( cid >= 0 && cid >> effect_index_bits == effect_types_generation ) {
+        return cid & effect_index_mask;
+    }
+    const auto iter = effect_types.find( id );
+    if( iter == effect_types.end() ) {
+        return -1;
+    }
+    const int index = iter->second.index;
+    if( index <= effect_index_mask ) {
+        id.set_cid( int_id<effect_type>( effect_types_generation << effect_index_bits | index ) );
+    }
+    return index;
+}
+
+void effects_map::update_type( const efftype_id &id )
+{
+    const int index = effect_type_index( id );
+    if( index < 0 ) {
+        return;
+    }
+    const size_t word = index / 64;
+    const std::uint64_t bit = std::uint64_t( 1 ) << ( index % 64 );
+    if( count( id ) > 0 ) {
+        if( word >= present.size() ) {
+            present.resize( word + 1, 0 );
+        }
+        present[word] |= bit;
+    } else if( word < present.size() ) {
+        present[word] &= ~bit;
+    }
+}
+
+void effect_type::register_effect( const effect_type &eff )
+{
+    const auto iter = effect_types.find( eff.id );
+    if( iter != effect_types.end() ) {
+        const int index = iter->second.index;
+        iter->second = eff;
+        iter->second.index = index;
+        return;
+    }
+    effect_type &added = effect_types.emplace( eff.id, eff ).first->second;
+    added.index = effect_types_by_index.size();
+    effect_types_by_index.push_back( &added );
+}
+
 const efftype_id effect_weed_high( "weed_high" );
 
 void weed_msg( player &p )
@@ -1303,7 +1361,7 @@ void load_effect_type( JsonObject &jo )
 
     new_etype.flags = jo.get_tags( "flags" );
 
-    effect_types[new_etype.id] = new_etype;
+    effect_type::register_effect( new_etype );
 }
 
 bool effect::has_flag( const std::string &flag ) const
@@ -1314,6 +1372,9 @@ bool effect::has_flag( const std::string &flag ) const
 void reset_effect_types()
 {
     effect_types.clear();
+    effect_types_by_index.clear();
+    // Stays positive, so a cached value is never mistaken for the -1 of an unresolved id
+    effect_types_generation = ( effect_types_generation + 1 ) % ( 1 << 14 );
 }
 
 void effect_type::register_ma_buff_effect( const effect_type &eff )
@@ -1323,7 +1384,7 @@ void effect_type::register_ma_buff_effect( const effect_type &eff )
                   eff.id.c_str() );
         return;
     }
-    effect_types.insert( std::make_pair( eff.id, eff ) );
+    register_effect( eff );
 }
 
 void effect::serialize( JsonOut &json ) const
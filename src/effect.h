@@ -3,6 +3,7 @@
 #define EFFECT_H
 
 #include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <tuple>
 #include <vector>
@@ -82,7 +83,19 @@ class effect_type
         /** Registers the effect in the global map */
         static void register_ma_buff_effect( const effect_type &eff );
 
+        /** Returns false if the effect doesn't change any stats, so it only has to count down. */
+        bool has_mod_data() const {
+            return !mod_data.empty();
+        }
+
     protected:
+        friend int effect_type_index( const efftype_id &id );
+
+        /** Dense index of this type, assigned when it is registered. */
+        int index = -1;
+        /** Stores the type in the global map, keeping the index of a type it replaces. */
+        static void register_effect( const effect_type &eff );
+
         int max_intensity;
         int max_effective_intensity;
         time_duration max_duration;
@@ -274,6 +287,10 @@ class effect
 
         /** Returns if the effect is supposed to be handed in Creature::movement */
         bool impairs_movement() const;
+        /** Returns false if the effect doesn't change any stats, see @ref effect_type::has_mod_data */
+        bool has_mod_data() const {
+            return eff_type->has_mod_data();
+        }
 
         /** Returns the effect's matching effect_type id. */
         const efftype_id &get_id() const {
@@ -295,6 +312,11 @@ class effect
 
 void load_effect_type( JsonObject &jo );
 void reset_effect_types();
+/**
+ * Returns a dense index for the effect type, or -1 if there is no such type. The index is
+ * cached in the id, so this is cheap for the usual static ids.
+ */
+int effect_type_index( const efftype_id &id );
 
 std::string texitify_base_healing_power( int power );
 std::string texitify_healing_power( int power );
@@ -304,6 +326,26 @@ std::string texitify_healing_power( int power );
 class effects_map : public
     std::unordered_map<efftype_id, std::unordered_map<body_part, effect, std::hash<int>>>
 {
+    public:
+        /**
+         * Whether there is an entry for the effect type with the given index. Creature keeps
+         * this in sync through @ref update_type, so has_effect can answer most queries (which
+         * are for effects the creature doesn't have) without hashing the id.
+         */
+        bool has_type( int index ) const {
+            const size_t word = index / 64;
+            return index >= 0 && word < present.size() && ( present[word] >> ( index % 64 ) & 1 );
+        }
+        /** Call after adding or removing entries for @p id. */
+        void update_type( const efftype_id &id );
+        void clear() {
+            std::unordered_map<efftype_id, std::unordered_map<body_part, effect, std::hash<int>>>::clear();
+            present.clear();
+        }
+
+    private:
+        /** Bit per effect type index */
+        std::vector<std::uint64_t> present;
 };
 
 #endif
@@ -20,6 +20,7 @@
 #include "cata_utility.h"
 #include "color.h"
 #include "coordinate_conversions.h"
+#include "creature_tracker.h"
 #include "creature.h"
 #include "damage.h"
 #include "debug.h"
@@ -549,7 +550,8 @@ void flashbang( const tripoint &p, bool player_immune )
                                  time_duration::from_turns( 10 - dist ) );
         }
     }
-    for( monster &critter : g->all_monsters() ) {
+    for( monster *const mon : g->critter_tracker->monsters_in_radius( p, 8, 8 ) ) {
+        monster &critter = *mon;
         // TODO: can the following code be called for all types of creatures
         dist = rl_dist( critter.pos(), p );
         if( dist <= 8 ) {
@@ -576,10 +578,10 @@ void shockwave( const tripoint &p, int radius, int force, int stun, int dam_mult
     sounds::sound( p, force * force * dam_mult / 2, sounds::sound_t::combat, _( "Crack!" ), false,
                    "misc", "shockwave" );
 
-    for( monster &critter : g->all_monsters() ) {
-        if( rl_dist( critter.pos(), p ) <= radius ) {
-            add_msg( _( "%s is caught in the shockwave!" ), critter.name() );
-            g->knockback( p, critter.pos(), force, stun, dam_mult );
+    for( monster *const critter : g->critter_tracker->monsters_in_radius( p, radius, radius ) ) {
+        if( rl_dist( critter->pos(), p ) <= radius ) {
+            add_msg( _( "%s is caught in the shockwave!" ), critter->name() );
+            g->knockback( p, critter->pos(), force, stun, dam_mult );
         }
     }
     // TODO: combine the two loops and the case for g->u using all_creatures()
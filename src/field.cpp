@@ -146,20 +146,47 @@ Function: find_field
 Returns a field entry corresponding to the field_type_id parameter passed in. If no fields are found then returns NULL.
 Good for checking for existence of a field: if(myfield.find_field(fd_fire)) would tell you if the field is on fire.
 */
-field_entry *field::find_field( const field_type_id field_type_to_find )
+field::field( const field &other )
+    : _field_type_list(), _field_count( 0 ), _displayed_field_type( fd_null )
+{
+    *this = other;
+}
+
+field &field::operator=( const field &other )
 {
-    const auto it = _field_type_list.find( field_type_to_find );
-    if( it != _field_type_list.end() ) {
-        return &it->second;
+    if( this == &other ) {
+        return *this;
     }
-    return nullptr;
+    _field_type_list.slots = other._field_type_list.slots;
+    _field_type_list.next.reset();
+    std::unique_ptr<block> *tail = &_field_type_list.next;
+    for( const block *blk = other._field_type_list.next.get(); blk != nullptr;
+         blk = blk->next.get() ) {
+        tail->reset( new block() );
+        ( *tail )->slots = blk->slots;
+        tail = &( *tail )->next;
+    }
+    _field_count = other._field_count;
+    _displayed_field_type = other._displayed_field_type;
+    return *this;
+}
+
+field_entry *field::find_field( const field_type_id field_type_to_find )
+{
+    return const_cast<field_entry *>( find_field_c( field_type_to_find ) );
 }
 
 const field_entry *field::find_field_c( const field_type_id field_type_to_find ) const
 {
-    const auto it = _field_type_list.find( field_type_to_find );
-    if( it != _field_type_list.end() ) {
-        return &it->second;
+    if( _field_count == 0 || field_type_to_find == field_type_id() ) {
+        return nullptr;
+    }
+    for( const block *blk = &_field_type_list; blk != nullptr; blk = blk->next.get() ) {
+        for( const entry &e : blk->slots ) {
+            if( e.first == field_type_to_find ) {
+                return &e.second;
+            }
+        }
     }
     return nullptr;
 }
@@ -180,40 +207,62 @@ Intensity defaults to 1, and age to 0 (permanent) if not specified.
 bool field::add_field( const field_type_id field_type_to_add, const int new_intensity,
                        const time_duration &new_age )
 {
-    auto it = _field_type_list.find( field_type_to_add );
+    if( field_type_to_add == field_type_id() ) {
+        return false;
+    }
     if( field_type_to_add.obj().priority >= _displayed_field_type.obj().priority ) {
         _displayed_field_type = field_type_to_add;
     }
-    if( it != _field_type_list.end() ) {
+    if( field_entry *existing = find_field( field_type_to_add ) ) {
         //Already exists, but lets update it. This is tentative.
-        it->second.set_field_intensity( it->second.get_field_intensity() + new_intensity );
+        existing->set_field_intensity( existing->get_field_intensity() + new_intensity );
         return false;
     }
-    _field_type_list[field_type_to_add] = field_entry( field_type_to_add, new_intensity, new_age );
-    return true;
+    // Take the first free slot, or chain a new block at the end.
+    block *blk = &_field_type_list;
+    while( true ) {
+        for( entry &e : blk->slots ) {
+            if( e.first == field_type_id() ) {
+                e = entry( field_type_to_add, field_entry( field_type_to_add, new_intensity, new_age ) );
+                _field_count++;
+                return true;
+            }
+        }
+        if( !blk->next ) {
+            blk->next.reset( new block() );
+        }
+        blk = blk->next.get();
+    }
 }
 
 bool field::remove_field( field_type_id const field_to_remove )
 {
-    const auto it = _field_type_list.find( field_to_remove );
-    if( it == _field_type_list.end() ) {
-        return false;
+    for( auto it = begin(); it != end(); ++it ) {
+        if( it->first == field_to_remove ) {
+            remove_field( it );
+            return true;
+        }
     }
-    remove_field( it );
-    return true;
+    return false;
 }
 
-void field::remove_field( std::map<field_type_id, field_entry>::iterator const it )
+void field::remove_field( iterator const it )
 {
-    _field_type_list.erase( it );
-    if( _field_type_list.empty() ) {
-        _displayed_field_type = fd_null;
-    } else {
-        _displayed_field_type = fd_null;
-        for( auto &fld : _field_type_list ) {
-            if( fld.first.obj().priority >= _displayed_field_type.obj().priority ) {
-                _displayed_field_type = fld.first;
-            }
+    *it = entry();
+    _field_count--;
+    _displayed_field_type = fd_null;
+    if( _field_count == 0 ) {
+        // Only the first block is kept around.
+        _field_type_list.next.reset();
+        return;
+    }
+    // Ties go to the highest type id, whatever slot it is in
+    for( auto &fld : *this ) {
+        const int priority = fld.first.obj().priority;
+        const int displayed_priority = _displayed_field_type.obj().priority;
+        if( priority > displayed_priority ||
+            ( priority == displayed_priority && _displayed_field_type < fld.first ) ) {
+            _displayed_field_type = fld.first;
         }
     }
 }
@@ -224,27 +273,27 @@ Returns the number of fields existing on the current tile.
 */
 unsigned int field::field_count() const
 {
-    return _field_type_list.size();
+    return _field_count;
 }
 
-std::map<field_type_id, field_entry>::iterator field::begin()
+field::iterator field::begin()
 {
-    return _field_type_list.begin();
+    return iterator( &_field_type_list, 0 );
 }
 
-std::map<field_type_id, field_entry>::const_iterator field::begin() const
+field::const_iterator field::begin() const
 {
-    return _field_type_list.begin();
+    return const_iterator( &_field_type_list, 0 );
 }
 
-std::map<field_type_id, field_entry>::iterator field::end()
+field::iterator field::end()
 {
-    return _field_type_list.end();
+    return iterator();
 }
 
-std::map<field_type_id, field_entry>::const_iterator field::end() const
+field::const_iterator field::end() const
 {
-    return _field_type_list.end();
+    return const_iterator();
 }
 
 /*
@@ -259,7 +308,7 @@ field_type_id field::displayed_field_type() const
 int field::total_move_cost() const
 {
     int current_cost = 0;
-    for( auto &fld : _field_type_list ) {
+    for( auto &fld : *this ) {
         current_cost += fld.second.move_cost();
     }
     return current_cost;
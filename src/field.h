@@ -2,8 +2,12 @@
 #ifndef FIELD_H
 #define FIELD_H
 
-#include <map>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "calendar.h"
 #include "color.h"
@@ -129,7 +133,91 @@ class field_entry
 class field
 {
     public:
+        using entry = std::pair<field_type_id, field_entry>;
+
+    private:
+        /**
+         * Entries live in small fixed blocks, the first one inside the field itself. Tiles
+         * rarely have more than a couple of fields, so most never allocate. Blocks never move
+         * and removed entries only free their slot (the null type id), so references to entries
+         * stay valid while fields are added or removed, e.g. while the tile is processed.
+         */
+        struct block {
+            std::array<entry, 2> slots;
+            std::unique_ptr<block> next;
+        };
+
+        template<typename Block, typename Entry>
+        class iterator_t
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = entry;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Entry *;
+                using reference = Entry &;
+
+                iterator_t() = default;
+                iterator_t( Block *blk, size_t slot ) : blk( blk ), slot( slot ) {
+                    skip_free();
+                }
+                template<typename OtherBlock, typename OtherEntry>
+                iterator_t( const iterator_t<OtherBlock, OtherEntry> &other ) :
+                    blk( other.blk ), slot( other.slot ) { }
+
+                reference operator*() const {
+                    return blk->slots[slot];
+                }
+                pointer operator->() const {
+                    return &blk->slots[slot];
+                }
+                iterator_t &operator++() {
+                    ++slot;
+                    skip_free();
+                    return *this;
+                }
+                iterator_t operator++( int ) {
+                    iterator_t ret = *this;
+                    ++*this;
+                    return ret;
+                }
+                bool operator==( const iterator_t &rhs ) const {
+                    return blk == rhs.blk && slot == rhs.slot;
+                }
+                bool operator!=( const iterator_t &rhs ) const {
+                    return !( *this == rhs );
+                }
+
+            private:
+                template<typename, typename>
+                friend class iterator_t;
+                friend class field;
+
+                void skip_free() {
+                    while( blk != nullptr ) {
+                        for( ; slot < blk->slots.size(); ++slot ) {
+                            if( blk->slots[slot].first != field_type_id() ) {
+                                return;
+                            }
+                        }
+                        blk = blk->next.get();
+                        slot = 0;
+                    }
+                }
+
+                Block *blk = nullptr;
+                size_t slot = 0;
+        };
+
+    public:
+        using iterator = iterator_t<block, entry>;
+        using const_iterator = iterator_t<const block, const entry>;
+
         field();
+        field( const field &other );
+        field( field && ) = default;
+        field &operator=( const field &other );
+        field &operator=( field && ) = default;
 
         /**
          * Returns a field entry corresponding to the field_type_id parameter passed in.
@@ -152,7 +240,7 @@ class field
          * If you wish to modify an already existing field use find_field and modify the result.
          * Intensity defaults to 1, and age to 0 (permanent) if not specified.
          * The intensity is added to an existing field entry, but the age is only used for newly added entries.
-         * @return false if the field_type_id already exists, true otherwise.
+         * @return false if the field_type_id already exists (or is the null id), true otherwise.
          */
         bool add_field( field_type_id field_type_to_add, int new_intensity = 1,
                         const time_duration &new_age = 0_turns );
@@ -166,9 +254,10 @@ class field
         bool remove_field( field_type_id field_to_remove );
         /**
          * Make sure to decrement the field counter in the submap.
-         * Removes the field entry, the iterator must point into @ref _field_type_list and must be valid.
+         * Removes the field entry, the iterator must point into this field and must be valid.
+         * Other iterators stay valid, so `remove_field( it++ )` works.
          */
-        void remove_field( std::map<field_type_id, field_entry>::iterator );
+        void remove_field( iterator );
 
         // Returns the number of fields existing on the current tile.
         unsigned int field_count() const;
@@ -178,13 +267,18 @@ class field
          */
         field_type_id displayed_field_type() const;
 
-        //Returns the vector iterator to begin searching through the list.
-        std::map<field_type_id, field_entry>::iterator begin();
-        std::map<field_type_id, field_entry>::const_iterator begin() const;
+        /**
+         * Returns the iterator to begin searching through the list.
+         * Entries come in the order of their slots, not by field type id: a new field takes
+         * the first free slot, so it comes after the older ones unless one of those was removed.
+         * Code going over the fields must not rely on any particular order.
+         */
+        iterator begin();
+        const_iterator begin() const;
 
         //Returns the vector iterator to end searching through the list.
-        std::map<field_type_id, field_entry>::iterator end();
-        std::map<field_type_id, field_entry>::const_iterator end() const;
+        iterator end();
+        const_iterator end() const;
 
         /**
          * Returns the total move cost from all fields.
@@ -192,8 +286,9 @@ class field
         int total_move_cost() const;
 
     private:
-        // A pointer lookup table of all field effects on the current tile.
-        std::map<field_type_id, field_entry> _field_type_list;
+        // All field effects on the current tile.
+        block _field_type_list;
+        unsigned int _field_count = 0;
         //_displayed_field_type currently is equal to the last field added to the square. You can modify this behavior in the class functions if you wish.
         field_type_id _displayed_field_type;
 };
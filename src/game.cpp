@@ -1506,6 +1506,9 @@ bool game::do_turn()
         scent.set( u.pos(), u.scent );
         overmap_buffer.set_scent( u.global_omt_location(),  u.scent );
     }
+    for( npc &guy : all_npcs() ) {
+        scent.set( guy.pos(), guy.scent, scent_type::npc );
+    }
     scent.update( u.pos(), m );
 
     // We need floor cache before checking falling 'n stuff
@@ -4168,7 +4171,14 @@ void game::monmove()
 {
     cleanup_dead();
 
+    // Idle monsters far from everyone only replan every few turns, staggered so
+    // they don't all replan on the same turn.
+    static constexpr int reduced_ai_interval = 5;
+    int monster_index = 0;
     for( monster &critter : all_monsters() ) {
+        const bool reduced_ai = critter.can_use_reduced_ai() &&
+                                ( to_turn<int>( calendar::turn ) + monster_index ) % reduced_ai_interval != 0;
+        monster_index++;
         // Critters in impassable tiles get pushed away, unless it's not impassable for them
         if( !critter.is_dead() && m.impassable( critter.pos() ) && !critter.can_move_to( critter.pos() ) ) {
             dbg( D_ERROR ) << "game:monmove: " << critter.name()
@@ -4200,13 +4210,14 @@ void game::monmove()
         while( critter.moves > 0 && !critter.is_dead() && !critter.has_effect( effect_ridden ) ) {
             critter.made_footstep = false;
             // Controlled critters don't make their own plans
-            if( !critter.has_effect( effect_controlled ) ) {
-                // Formulate a path to follow
-                critter.plan();
-            } else {
+            if( critter.has_effect( effect_controlled ) ) {
                 critter.moves = 0;
                 break;
             }
+            // Formulate a path to follow, unless we keep wandering along the last one
+            if( !reduced_ai ) {
+                critter.plan();
+            }
             critter.move(); // Move one square, possibly hit u
             critter.process_triggers();
             m.creature_in_field( critter );
@@ -4241,6 +4252,21 @@ void game::monmove()
         }
     }
 
+    // Same for the NPCs: which monsters each NPC sees as friends or possible threats is
+    // sorted out up front (in parallel when there are many), for their first assess_danger.
+    std::vector<npc *> assessors;
+    for( npc &guy : all_npcs() ) {
+        assessors.push_back( &guy );
+    }
+    std::vector<std::shared_ptr<monster>> assessed;
+    for( monster &critter : all_monsters() ) {
+        assessed.push_back( shared_from( critter ) );
+    }
+    std::vector<npc_danger_candidates> candidates = gather_danger_candidates( assessors, assessed );
+    for( size_t i = 0; i < assessors.size(); ++i ) {
+        assessors[i]->set_danger_candidates( std::move( candidates[i] ) );
+    }
+
     // Now, do active NPCs.
     for( npc &guy : g->all_npcs() ) {
         int turns = 0;
@@ -4294,6 +4320,7 @@ void game::overmap_npc_move()
             travelling_npcs.push_back( npc_to_add );
         }
     }
+    bool npcs_moved = false;
     for( auto &elem : travelling_npcs ) {
         if( elem->has_omt_destination() ) {
             if( !elem->omt_path.empty() && rl_dist( elem->omt_path.back(), elem->global_omt_location() ) > 2 ) {
@@ -4308,10 +4335,20 @@ void game::overmap_npc_move()
                 }
                 elem->travel_overmap( omt_to_sm_copy( elem->omt_path.back() ) );
             }
-            reload_npcs();
+            npcs_moved = true;
         }
     }
-    return;
+    // NPCs outside the reality bubble keep their needs and effects roughly up to date,
+    // so loading them doesn't have to catch up on days at once.
+    for( const std::shared_ptr<npc> &guy : overmap_buffer.get_overmap_npcs() ) {
+        if( !guy->is_active() ) {
+            guy->update_offscreen();
+        }
+    }
+    // Reloading once for all of them, reloading unloads and loads every nearby NPC
+    if( npcs_moved ) {
+        reload_npcs();
+    }
 }
 
 /* Knockback target at t by force number of tiles in direction from s to t
@@ -4588,7 +4625,7 @@ void game::use_computer( const tripoint &p )
 template<typename T>
 T *game::critter_at( const tripoint &p, bool allow_hallucination )
 {
-    if( const std::shared_ptr<monster> mon_ptr = critter_tracker->find( p ) ) {
+    if( monster *const mon_ptr = critter_tracker->find_unowned( p ) ) {
         if( !allow_hallucination && mon_ptr->is_hallucination() ) {
             return nullptr;
         }
@@ -4602,7 +4639,7 @@ T *game::critter_at( const tripoint &p, bool allow_hallucination )
         if( !mon_ptr->has_effect( effect_ridden ) || ( std::is_same<T, monster>::value ||
                 std::is_same<T, Creature>::value || std::is_same<T, const monster>::value ||
                 std::is_same<T, const Creature>::value ) ) {
-            return dynamic_cast<T *>( mon_ptr.get() );
+            return dynamic_cast<T *>( mon_ptr );
         }
     }
     if( p == u.pos() ) {
@@ -4711,7 +4748,7 @@ monster *game::place_critter_around( const mtype_id &id, const tripoint &center,
     if( id.is_null() ) {
         return nullptr;
     }
-    return place_critter_around( std::make_shared<monster>( id ), center, radius );
+    return place_critter_around( make_shared_monster( id ), center, radius );
 }
 
 monster *game::place_critter_around( const std::shared_ptr<monster> mon, const tripoint &center,
@@ -4741,7 +4778,7 @@ monster *game::place_critter_within( const mtype_id &id, const tripoint_range &r
     if( id.is_null() ) {
         return nullptr;
     }
-    return place_critter_within( std::make_shared<monster>( id ), range );
+    return place_critter_within( make_shared_monster( id ), range );
 }
 
 monster *game::place_critter_within( const std::shared_ptr<monster> mon,
@@ -4798,7 +4835,7 @@ bool game::spawn_hallucination( const tripoint &p )
     }
 
     const mtype_id &mt = MonsterGenerator::generator().get_valid_hallucination();
-    const std::shared_ptr<monster> phantasm = std::make_shared<monster>( mt );
+    const std::shared_ptr<monster> phantasm = make_shared_monster( mt );
     phantasm->hallucination = true;
     phantasm->spawn( p );
 
@@ -4908,7 +4945,7 @@ bool game::revive_corpse( const tripoint &p, item &it )
         debugmsg( "Tried to revive a non-corpse." );
         return false;
     }
-    std::shared_ptr<monster> newmon_ptr = std::make_shared<monster>( it.get_mtype()->id );
+    std::shared_ptr<monster> newmon_ptr = make_shared_monster( it.get_mtype()->id );
     monster &critter = *newmon_ptr;
     critter.init_from_item( it );
     if( critter.get_hp() < 1 ) {
@@ -10365,7 +10402,7 @@ void game::vertical_move( int movez, bool force )
         // Store a *copy* of the mount, so we can remove the original monster instance
         // from the tracker before the map shifts.
         // Map shifting would otherwise just despawn the mount and would later respawn it.
-        stored_mount = std::make_shared<monster>( *u.mounted_creature );
+        stored_mount = make_shared_monster( *u.mounted_creature );
         critter_tracker->remove( *u.mounted_creature );
     }
     if( !m.has_zlevels() ) {
@@ -10868,7 +10905,7 @@ void game::replace_stair_monsters()
     for( auto &elem : coming_to_stairs ) {
         elem.staircount = 0;
         const tripoint pnt( elem.pos().xy(), get_levz() );
-        place_critter_around( std::make_shared<monster>( elem ), pnt, 10 );
+        place_critter_around( make_shared_monster( elem ), pnt, 10 );
     }
 
     coming_to_stairs.clear();
@@ -10975,7 +11012,7 @@ void game::update_stair_monsters()
         if( is_empty( dest ) ) {
             critter.spawn( dest );
             critter.staircount = 0;
-            place_critter_at( std::make_shared<monster>( critter ), dest );
+            place_critter_at( make_shared_monster( critter ), dest );
             if( u.sees( dest ) ) {
                 if( !from_below ) {
                     add_msg( m_warning, _( "The %1$s comes down the %2$s!" ),
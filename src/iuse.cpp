@@ -9190,7 +9190,7 @@ int iuse::capture_monster_veh( player *p, item *it, bool, const tripoint &pos )
 
 bool item::release_monster( const tripoint &target, const int radius )
 {
-    std::shared_ptr<monster> new_monster = std::make_shared<monster>();
+    std::shared_ptr<monster> new_monster = make_shared_monster();
     try {
         ::deserialize( *new_monster, get_var( "contained_json", "" ) );
     } catch( const std::exception &e ) {
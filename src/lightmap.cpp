@@ -128,6 +128,9 @@ bool map::build_transparency_cache( const int zlev )
                         zero_value = value;
                         continue;
                     }
+                    if( !cur_submap->field_tiles.test( submap::field_tile( { sx, sy } ) ) ) {
+                        continue;
+                    }
                     for( const auto &fld : cur_submap->fld[sx][sy] ) {
                         const field_entry &cur = fld.second;
                         if( cur.is_transparent() ) {
@@ -333,6 +336,9 @@ void map::generate_lightmap( const int zlev )
                         add_light_source( p, furniture->light_emitted );
                     }
 
+                    if( !cur_submap->field_tiles.test( submap::field_tile( { sx, sy } ) ) ) {
+                        continue;
+                    }
                     for( auto &fld : cur_submap->fld[sx][sy] ) {
                         const field_entry *cur = &fld.second;
                         const int light_emitted = cur->light_emitted();
@@ -2776,6 +2776,9 @@ void map::decay_fields_and_scent( const time_duration &amount )
                 }
 
                 for( int sy = 0; sy < SEEY; ++sy ) {
+                    if( !cur_submap->field_tiles.test( submap::field_tile( { sx, sy } ) ) ) {
+                        continue;
+                    }
                     const int x = sx + smx * SEEX;
                     const int y = sy + smy * SEEY;
 
@@ -5522,6 +5525,7 @@ bool map::add_field( const tripoint &p, const field_type_id type, int intensity,
     current_submap->is_uniform = false;
 
     if( current_submap->fld[l.x][l.y].add_field( type, intensity, age ) ) {
+        current_submap->field_tiles.set( submap::field_tile( l ) );
         //Only adding it to the count if it doesn't exist.
         if( ! current_submap->field_count++ ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -5559,6 +5563,9 @@ void map::remove_field( const tripoint &p, const field_type_id field_to_remove )
     submap *const current_submap = get_submap_at( p, l );
 
     if( current_submap->fld[l.x][l.y].remove_field( field_to_remove ) ) {
+        if( current_submap->fld[l.x][l.y].field_count() == 0 ) {
+            current_submap->field_tiles.reset( submap::field_tile( l ) );
+        }
         // Only adjust the count if the field actually existed.
         if( ! --current_submap->field_count ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -7408,6 +7415,7 @@ void map::add_roofs( const tripoint &grid )
             }
         }
     }
+    sub_here->set_scent_flags_dirty();
 }
 
 void map::copy_grid( const tripoint &to, const tripoint &from )
@@ -7543,7 +7551,7 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
                          tmp.wander_pos.x, tmp.wander_pos.y, tmp.wander_pos.z );
             }
 
-            monster *const placed = g->place_critter_at( std::make_shared<monster>( tmp ), p );
+            monster *const placed = g->place_critter_at( make_shared_monster( tmp ), p );
             if( placed ) {
                 placed->on_load();
             }
@@ -7587,7 +7595,7 @@ void map::spawn_monsters_submap( const tripoint &gp, bool ignore_sight )
             };
 
             const auto place_it = [&]( const tripoint & p ) {
-                monster *const placed = g->place_critter_at( std::make_shared<monster>( tmp ), p );
+                monster *const placed = g->place_critter_at( make_shared_monster( tmp ), p );
                 if( placed ) {
                     placed->on_load();
                 }
@@ -8442,23 +8450,13 @@ void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &bl
                           std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &reduces_scent,
                           const point &min, const point &max )
 {
-    auto reduce = TFLAG_REDUCE_SCENT;
-    auto block = TFLAG_WALL;
     auto fill_values = [&]( const tripoint & gp, const submap * sm, const point & lp ) {
         // We need to generate the x/y coordinates, because we can't get them "for free"
         const int x = gp.x * SEEX + lp.x;
         const int y = gp.y * SEEY + lp.y;
-        if( sm->get_ter( lp ).obj().has_flag( block ) ) {
-            blocks_scent[x][y] = true;
-            reduces_scent[x][y] = false;
-        } else if( sm->get_ter( lp ).obj().has_flag( reduce ) ||
-                   sm->get_furn( lp ).obj().has_flag( reduce ) ) {
-            blocks_scent[x][y] = false;
-            reduces_scent[x][y] = true;
-        } else {
-            blocks_scent[x][y] = false;
-            reduces_scent[x][y] = false;
-        }
+        const submap::scent_flag flag = sm->get_scent_flag( lp );
+        blocks_scent[x][y] = flag == submap::scent_flag::blocks;
+        reduces_scent[x][y] = flag == submap::scent_flag::reduces;
 
         return ITER_CONTINUE;
     };
@@ -524,6 +524,21 @@ class map
                                      const pathfinding_settings &settings,
         const std::set<tripoint> &pre_closed = {{ }} ) const;
 
+        /**
+         * Calculate the best paths to several destinations with a single search.
+         * Much cheaper than calling route() for every candidate when looking for the closest ones.
+         *
+         * @param f The source location from which to path.
+         * @param targets The destinations. Ones out of pathfinding range or equal to `f` are skipped.
+         * @param settings Structure describing pathfinding parameters.
+         * @param max_routes Stop after finding paths to this many destinations, 0 means all of them.
+         * @param pre_closed Never path through those points. They can still be the source or the destination.
+         * @return Paths to the reachable destinations, cheapest first.
+         */
+        std::vector<std::vector<tripoint>> routes( const tripoint &f, const std::vector<tripoint> &targets,
+                                        const pathfinding_settings &settings, size_t max_routes = 0,
+        const std::set<tripoint> &pre_closed = {{ }} ) const;
+
         // Vehicles: Common to 2D and 3D
         VehicleList get_vehicles();
         void add_vehicle_to_cache( vehicle * );
@@ -1521,6 +1536,14 @@ class map
     private:
         // Caclulate the greatest populated zlevel in the loaded submaps and save in the level cache.
         void calc_max_populated_zlev();
+        /**
+         * Search shared by route() and routes(). A* when given a single target, Dijkstra otherwise.
+         * Targets must already be inbounds and within the settings' range.
+         */
+        std::vector<std::vector<tripoint>> find_routes( const tripoint &f,
+                                        const std::vector<tripoint> &targets,
+                                        const pathfinding_settings &settings,
+                                        const std::set<tripoint> &pre_closed, size_t max_routes ) const;
         /**
          * Internal versions of public functions to avoid checking same variables multiple times.
          * They lack safety checks, because their callers already do those.
@@ -396,6 +396,11 @@ bool map::process_fields_in_submap( submap *const current_submap,
     // Loop through all tiles in this submap indicated by current_submap
     for( locx = 0; locx < SEEX; locx++ ) {
         for( locy = 0; locy < SEEY; locy++ ) {
+            // Fields added to later tiles while processing this one are seen in this same pass.
+            const size_t tile = submap::field_tile( map_tile.pos() );
+            if( !current_submap->field_tiles.test( tile ) ) {
+                continue;
+            }
             // This is a translation from local coordinates to submap coordinates.
             // All submaps are in one long 1d array.
             thep.x = locx + submap.x * SEEX;
@@ -1304,6 +1309,9 @@ bool map::process_fields_in_submap( submap *const current_submap,
                     ++it;
                 }
             }
+            if( curfield.field_count() == 0 ) {
+                current_submap->field_tiles.reset( tile );
+            }
         }
     }
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
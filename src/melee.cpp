@@ -16,10 +16,13 @@
 #include <cmath>
 
 #include "avatar.h"
+#include "bionics.h"
 #include "cata_utility.h"
 #include "debug.h"
+#include "effect.h"
 #include "game.h"
 #include "game_inventory.h"
+#include "hash_utils.h"
 #include "itype.h"
 #include "line.h"
 #include "map.h"
@@ -33,6 +36,7 @@
 #include "output.h"
 #include "player.h"
 #include "rng.h"
+#include "skill.h"
 #include "sounds.h"
 #include "string_formatter.h"
 #include "translations.h"
@@ -2143,6 +2147,33 @@ int player::attack_speed( const item &weap ) const
     return move_cost;
 }
 
+bool player::weapon_value_stamp::operator==( const weapon_value_stamp &rhs ) const
+{
+    return skill_changes == rhs.skill_changes && stats == rhs.stats &&
+           encumbrance == rhs.encumbrance && weapon_volume == rhs.weapon_volume &&
+           effects == rhs.effects && mutations == rhs.mutations &&
+           active_bionics == rhs.active_bionics && underwater == rhs.underwater;
+}
+
+bool player::weapon_value_key::operator==( const weapon_value_key &rhs ) const
+{
+    return type == rhs.type && ammo == rhs.ammo && ammo_count == rhs.ammo_count &&
+           ammo_remaining == rhs.ammo_remaining && damage == rhs.damage && burnt == rhs.burnt &&
+           details == rhs.details;
+}
+
+size_t player::weapon_value_key::hash::operator()( const weapon_value_key &key ) const
+{
+    size_t seed = std::hash<const itype *>()( key.type );
+    cata::hash_combine( seed, key.ammo );
+    cata::hash_combine( seed, key.ammo_count );
+    cata::hash_combine( seed, key.ammo_remaining );
+    cata::hash_combine( seed, key.damage );
+    cata::hash_combine( seed, key.burnt );
+    cata::hash_combine( seed, key.details );
+    return seed;
+}
+
 double player::weapon_value( const item &weap, int ammo ) const
 {
     if( is_wielding( weap ) ) {
@@ -2151,6 +2182,57 @@ double player::weapon_value( const item &weap, int ammo ) const
             return cached_value->second;
         }
     }
+
+    // NPCs evaluate the same kinds of items over and over when trading and looting,
+    // so remember the values until something they depend on changes.
+    weapon_value_stamp stamp;
+    stamp.skill_changes = SkillLevel::level_changes;
+    stamp.stats = {{ get_str(), get_dex(), get_per(), get_int() }};
+    stamp.encumbrance = {{
+            encumb( bp_hand_l ), encumb( bp_hand_r ), encumb( bp_arm_l ), encumb( bp_arm_r )
+        }
+    };
+    stamp.weapon_volume = units::to_milliliter( weapon.volume() );
+    stamp.effects = effects->size();
+    stamp.mutations = my_mutations.size();
+    stamp.active_bionics = std::count_if( my_bionics->begin(), my_bionics->end(),
+    []( const bionic & bio ) {
+        return bio.powered;
+    } );
+    stamp.underwater = is_underwater();
+    // Don't let the memo grow without bounds when an NPC goes through a lot of loot
+    static constexpr size_t max_memoized_weapon_values = 512;
+    if( !( stamp == weapon_value_stamped ) ||
+        weapon_value_memo.size() >= max_memoized_weapon_values ) {
+        weapon_value_memo.clear();
+        weapon_value_stamped = stamp;
+    }
+
+    weapon_value_key key;
+    key.type = weap.type;
+    key.ammo = weap.ammo_data();
+    key.ammo_count = ammo;
+    key.ammo_remaining = weap.ammo_remaining();
+    key.damage = weap.damage();
+    key.burnt = weap.burnt;
+    for( const item &content : weap.contents ) {
+        cata::hash_combine( key.details, content.typeId() );
+        cata::hash_combine( key.details, content.charges );
+    }
+    for( const std::string &flag : weap.item_tags ) {
+        cata::hash_combine( key.details, flag );
+    }
+    for( const matec_id &tec : weap.get_techniques() ) {
+        cata::hash_combine( key.details, tec.str() );
+    }
+    const auto memoized = weapon_value_memo.find( key );
+    if( memoized != weapon_value_memo.end() ) {
+        if( is_wielding( weap ) ) {
+            cached_info.emplace( "weapon_value", memoized->second );
+        }
+        return memoized->second;
+    }
+
     const double val_gun = gun_value( weap, ammo );
     const double val_melee = melee_value( weap );
     const double more = std::max( val_gun, val_melee );
@@ -2162,6 +2244,7 @@ double player::weapon_value( const item &weap, int ammo ) const
     if( is_wielding( weap ) ) {
         cached_info.emplace( "weapon_value", my_val );
     }
+    weapon_value_memo.emplace( key, my_val );
     return my_val;
 }
 
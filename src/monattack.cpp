@@ -18,6 +18,7 @@
 #include "avatar.h"
 #include "ballistics.h"
 #include "bodypart.h"
+#include "creature_tracker.h"
 #include "debug.h"
 #include "effect.h"
 #include "timed_event.h"
@@ -3856,13 +3857,13 @@ bool mattack::generator( monster *z )
 bool mattack::upgrade( monster *z )
 {
     std::vector<monster *> targets;
-    for( monster &zed : g->all_monsters() ) {
+    for( monster *zed : g->critter_tracker->monsters_in_radius( z->pos(), 10, 10 ) ) {
         // Check this first because it is a relatively cheap check
-        if( zed.can_upgrade() ) {
+        if( zed->can_upgrade() ) {
             // Then do the more expensive ones
-            if( z->attitude_to( zed ) != Creature::Attitude::A_HOSTILE &&
-                within_target_range( z, &zed, 10 ) ) {
-                targets.push_back( &zed );
+            if( z->attitude_to( *zed ) != Creature::Attitude::A_HOSTILE &&
+                within_target_range( z, zed, 10 ) ) {
+                targets.push_back( zed );
             }
         }
     }
@@ -103,6 +103,15 @@ static void apply_base_faction( mfaction_id base, mfaction_id faction_id )
 }
 
 mf_attitude monfaction::attitude( const mfaction_id &other ) const
+{
+    const size_t index = other.to_i();
+    if( index < attitude_row.size() ) {
+        return attitude_row[index];
+    }
+    return resolve_attitude( other );
+}
+
+mf_attitude monfaction::resolve_attitude( const mfaction_id &other ) const
 {
     const auto &found = attitude_map.find( other );
     if( found != attitude_map.end() ) {
@@ -111,7 +120,7 @@ mf_attitude monfaction::attitude( const mfaction_id &other ) const
 
     const auto base = other.obj().base_faction;
     if( other != base ) {
-        return attitude( base );
+        return resolve_attitude( base );
     }
 
     // Shouldn't happen
@@ -202,6 +211,16 @@ void monfactions::finalize()
     }
 
     faction_list.shrink_to_fit(); // Save a couple of bytes
+
+    // Monsters check their attitude to every nearby monster each turn, so resolve all the
+    // pairs now instead of walking the base factions every time.
+    for( auto &faction : faction_list ) {
+        faction.attitude_row.clear();
+        faction.attitude_row.reserve( faction_list.size() );
+        for( const auto &other : faction_list ) {
+            faction.attitude_row.push_back( faction.resolve_attitude( other.loadid ) );
+        }
+    }
 }
 
 // Ensures all those factions exist
@@ -3,6 +3,7 @@
 #define MONFACTION_H
 
 #include <unordered_map>
+#include <vector>
 
 #include "int_id.h"
 #include "type_id.h"
@@ -32,8 +33,15 @@ class monfaction
         mfaction_str_id id;
 
         mfaction_att_map attitude_map;
+        /**
+         * Attitude towards every faction, indexed by mfaction_id. Filled in by
+         * monfactions::finalize from @ref attitude_map and the base factions.
+         */
+        std::vector<mf_attitude> attitude_row;
 
         mf_attitude attitude( const mfaction_id &other ) const;
+        /** Same as @ref attitude, but walks the base factions instead of using the cache. */
+        mf_attitude resolve_attitude( const mfaction_id &other ) const;
 };
 
 #endif
@@ -58,6 +58,7 @@ const efftype_id effect_no_sight( "no_sight" );
 const efftype_id effect_operating( "operating" );
 const efftype_id effect_pacified( "pacified" );
 const efftype_id effect_pushed( "pushed" );
+const efftype_id effect_ridden( "ridden" );
 const efftype_id effect_stunned( "stunned" );
 const efftype_id effect_harnessed( "harnessed" );
 
@@ -265,10 +266,55 @@ float monster::rate_target( Creature &c, float best, bool smart ) const
     return INT_MAX;
 }
 
+// Nothing further than this can be seen (see Creature::sees), so only creatures
+// this close can ever be rated as targets or allies.
+static int max_sight_radius( const monster &mon )
+{
+    return std::max( mon.sight_range( default_daylight_level() ), mon.sight_range( 0 ) );
+}
+
+std::vector<monster *> monster::plan_candidates() const
+{
+    const int sight_radius = max_sight_radius( *this );
+    return g->critter_tracker->monsters_in_radius( pos(), sight_radius,
+            fov_3d ? sight_radius : 0 );
+}
+
 void monster::plan()
 {
-    const auto &factions = g->critter_tracker->factions();
+    plan( plan_candidates() );
+}
+
+bool monster::can_use_reduced_ai() const
+{
+    if( friendly != 0 || goal != pos() || wandf > 0 || has_effect( effect_dragging ) ||
+        has_effect( effect_ridden ) ) {
+        return false;
+    }
+    // Same creatures that plan() would consider as targets
+    const int sight_radius = max_sight_radius( *this );
+    const auto hates = [this]( const mfaction_id & other ) {
+        const mf_attitude att = faction.obj().attitude( other );
+        return att != MFA_NEUTRAL && att != MFA_FRIENDLY;
+    };
+    if( rl_dist( pos(), g->u.pos() ) <= sight_radius ) {
+        return false;
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        if( rl_dist( pos(), guy.pos() ) <= sight_radius && hates( guy.get_monster_faction() ) ) {
+            return false;
+        }
+    }
+    for( const monster *mon : plan_candidates() ) {
+        if( mon != this && !mon->is_dead() && hates( Creature_tracker::member_faction( *mon ) ) ) {
+            return false;
+        }
+    }
+    return true;
+}
 
+void monster::plan( const std::vector<monster *> &nearby )
+{
     // Bots are more intelligent than most living stuff
     bool smart_planning = has_flag( MF_PRIORITIZE_TARGETS );
     Creature *target = nullptr;
@@ -314,11 +360,14 @@ void monster::plan()
             }
         }
         if( angers_cub_threatened > 0 ) {
-            for( monster &tmp : g->all_monsters() ) {
-                if( type->baby_monster == tmp.type->id ) {
+            // Smart ratings are scaled by power, so they can't be bounded by distance
+            const int baby_radius = smart_planning ? MAPSIZE_X : 3;
+            for( monster *tmp : g->critter_tracker->monsters_in_radius( g->u.pos(), baby_radius,
+                    fov_3d ? baby_radius : 0 ) ) {
+                if( type->baby_monster == tmp->type->id ) {
                     // baby nearby; is the player too close?
-                    dist = tmp.rate_target( g->u, dist, smart_planning );
-                    if( dist <= 3 ) {
+                    const float baby_dist = tmp->rate_target( g->u, dist, smart_planning );
+                    if( baby_dist <= 3 ) {
                         //proximity to baby; monster gets furious and less likely to flee
                         anger += angers_cub_threatened;
                         morale += angers_cub_threatened / 2;
@@ -327,11 +376,11 @@ void monster::plan()
             }
         }
     } else if( friendly != 0 && !docile ) {
-        for( monster &tmp : g->all_monsters() ) {
-            if( tmp.friendly == 0 ) {
-                float rating = rate_target( tmp, dist, smart_planning );
+        for( monster *tmp : nearby ) {
+            if( tmp->friendly == 0 && !tmp->is_dead() ) {
+                float rating = rate_target( *tmp, dist, smart_planning );
                 if( rating < dist ) {
-                    target = &tmp;
+                    target = tmp;
                     dist = rating;
                 }
             }
@@ -384,38 +433,34 @@ void monster::plan()
         }
     }
 
+
     fleeing = fleeing || ( mood == MATT_FLEE );
     if( friendly == 0 ) {
-        for( const auto &fac : factions ) {
-            auto faction_att = faction.obj().attitude( fac.first );
+        for( monster *mon : nearby ) {
+            if( mon->is_dead() ) {
+                continue;
+            }
+            auto faction_att = faction.obj().attitude( Creature_tracker::member_faction( *mon ) );
             if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
                 continue;
             }
 
-            for( const std::weak_ptr<monster> &weak : fac.second ) {
-                const std::shared_ptr<monster> shared = weak.lock();
-                if( !shared ) {
-                    continue;
-                }
-                monster &mon = *shared;
-                float rating = rate_target( mon, dist, smart_planning );
-                if( rating < dist ) {
-                    target = &mon;
-                    dist = rating;
-                }
-                if( rating <= 5 ) {
-                    anger += angers_hostile_near;
-                    morale -= fears_hostile_near;
-                }
+            float rating = rate_target( *mon, dist, smart_planning );
+            if( rating < dist ) {
+                target = mon;
+                dist = rating;
+            }
+            if( rating <= 5 ) {
+                anger += angers_hostile_near;
+                morale -= fears_hostile_near;
             }
         }
     }
 
     // Friendly monsters here
     // Avoid for hordes of same-faction stuff or it could get expensive
-    const auto actual_faction = friendly == 0 ? faction : mfaction_str_id( "player" );
-    const auto &myfaction_iter = factions.find( actual_faction );
-    if( myfaction_iter == factions.end() ) {
+    const auto actual_faction = Creature_tracker::member_faction( *this );
+    if( g->critter_tracker->faction_members( actual_faction ).empty() ) {
         DebugLog( D_ERROR, D_GAME ) << disp_name() << " tried to find faction "
                                     << actual_faction.id().str()
                                     << " which wasn't loaded in game::monmove";
@@ -424,12 +469,11 @@ void monster::plan()
     }
     swarms = swarms && target == nullptr; // Only swarm if we have no target
     if( group_morale || swarms ) {
-        for( const std::weak_ptr<monster> &weak : myfaction_iter->second ) {
-            const std::shared_ptr<monster> shared = weak.lock();
-            if( !shared ) {
+        for( monster *ally : nearby ) {
+            if( ally->is_dead() || Creature_tracker::member_faction( *ally ) != actual_faction ) {
                 continue;
             }
-            monster &mon = *shared;
+            monster &mon = *ally;
             float rating = rate_target( mon, dist, smart_planning );
             if( group_morale && rating <= 10 ) {
                 morale += 10 - rating;
@@ -1062,18 +1106,24 @@ tripoint monster::scent_move()
     }
 
     const bool fleeing = is_fleeing( g->u );
+    // Follow whichever trail is stronger here, the avatar's or an NPC's
+    scent_type tracked = scent_type::avatar;
+    if( !fleeing && friendly == 0 &&
+        g->scent.get( pos(), scent_type::npc ) > g->scent.get( pos() ) ) {
+        tracked = scent_type::npc;
+    }
     if( fleeing ) {
         bestsmell = g->scent.get( pos() );
     }
 
     tripoint next( -1, -1, posz() );
-    if( ( !fleeing && g->scent.get( pos() ) > smell_threshold ) ||
+    if( ( !fleeing && g->scent.get( pos(), tracked ) > smell_threshold ) ||
         ( fleeing && bestsmell == 0 ) ) {
         return next;
     }
     const bool can_bash = bash_skill() > 0;
     for( const auto &dest : g->m.points_in_radius( pos(), 1, SCENT_MAP_Z_REACH ) ) {
-        int smell = g->scent.get( dest );
+        int smell = g->scent.get( dest, tracked );
         if( ( !fleeing && smell < bestsmell ) || ( fleeing && smell > bestsmell ) ) {
             continue;
         }
@@ -2287,26 +2287,29 @@ void monster::drop_items_on_death()
 
 void monster::process_one_effect( effect &it, bool is_new )
 {
-    // Monsters don't get trait-based reduction, but they do get effect based reduction
-    bool reduced = resists_effect( it );
-    const auto get_effect = [&it, is_new]( const std::string & arg, bool reduced ) {
-        if( is_new ) {
-            return it.get_amount( arg, reduced );
-        }
-        return it.get_mod( arg, reduced );
-    };
-
-    mod_speed_bonus( get_effect( "SPEED", reduced ) );
-    mod_dodge_bonus( get_effect( "DODGE", reduced ) );
-    mod_hit_bonus( get_effect( "HIT", reduced ) );
-    mod_bash_bonus( get_effect( "BASH", reduced ) );
-    mod_cut_bonus( get_effect( "CUT", reduced ) );
-    mod_size_bonus( get_effect( "SIZE", reduced ) );
-
-    int val = get_effect( "HURT", reduced );
-    if( val > 0 ) {
-        if( is_new || it.activated( calendar::turn, "HURT", val, reduced, 1 ) ) {
-            apply_damage( nullptr, bp_torso, val );
+    // Most effects on monsters are plain countdowns, skip all the string keyed lookups for them
+    if( it.has_mod_data() ) {
+        // Monsters don't get trait-based reduction, but they do get effect based reduction
+        bool reduced = resists_effect( it );
+        const auto get_effect = [&it, is_new]( const std::string & arg, bool reduced ) {
+            if( is_new ) {
+                return it.get_amount( arg, reduced );
+            }
+            return it.get_mod( arg, reduced );
+        };
+
+        mod_speed_bonus( get_effect( "SPEED", reduced ) );
+        mod_dodge_bonus( get_effect( "DODGE", reduced ) );
+        mod_hit_bonus( get_effect( "HIT", reduced ) );
+        mod_bash_bonus( get_effect( "BASH", reduced ) );
+        mod_cut_bonus( get_effect( "CUT", reduced ) );
+        mod_size_bonus( get_effect( "SIZE", reduced ) );
+
+        int val = get_effect( "HURT", reduced );
+        if( val > 0 ) {
+            if( is_new || it.activated( calendar::turn, "HURT", val, reduced, 1 ) ) {
+                apply_damage( nullptr, bp_torso, val );
+            }
         }
     }
 
@@ -7,6 +7,7 @@
 #include <bitset>
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "item.h"
 #include "mtype.h"
 #include "optional.h"
+#include "pool_allocator.h"
 #include "pldata.h"
 #include "type_id.h"
 #include "units.h"
@@ -195,7 +197,18 @@ class monster : public Creature
 
         // How good of a target is given creature (checks for visibility)
         float rate_target( Creature &c, float best, bool smart = false ) const;
+        /** Monsters close enough to be rated by @ref plan. */
+        std::vector<monster *> plan_candidates() const;
         void plan();
+        /** Same as @ref plan, rating only the given monsters from @ref plan_candidates. */
+        void plan( const std::vector<monster *> &nearby );
+        /**
+         * Whether this monster is idle and has nothing in sight range it could target, so it
+         * is fine to only call @ref plan every few turns and let it keep wandering in between.
+         * Becomes false as soon as it has a destination, hears something or the avatar,
+         * a hostile NPC or a hostile monster comes within sight range.
+         */
+        bool can_use_reduced_ai() const;
         void move(); // Actual movement
         void footsteps( const tripoint &p ); // noise made by movement
         void shove_vehicle( const tripoint &remote_destination,
@@ -543,4 +556,16 @@ class monster : public Creature
         void process_one_effect( effect &it, bool is_new ) override;
 };
 
+/**
+ * Creates a monster for the @ref Creature_tracker. Monsters and their reference counts
+ * share one block from a pool, so spawning and despawning hordes doesn't churn the heap,
+ * and monsters spawned together end up next to each other in memory.
+ */
+template<typename... Args>
+std::shared_ptr<monster> make_shared_monster( Args &&... args )
+{
+    return std::allocate_shared<monster>( cata::pool_allocator<monster>(),
+                                          std::forward<Args>( args )... );
+}
+
 #endif
@@ -1413,6 +1413,7 @@ void npc::make_angry()
 
 void npc::on_attacked( const Creature &attacker )
 {
+    invalidate_calm_decision();
     if( is_hallucination() ) {
         die( nullptr );
     }
@@ -1715,7 +1716,6 @@ int npc::value( const item &it, int market_price ) const
     }
 
     int ret = 0;
-    // TODO: Cache own weapon value (it can be a bit expensive to compute 50 times/turn)
     double weapon_val = weapon_value( it ) - weapon_value( weapon );
     if( weapon_val > 0 ) {
         ret += weapon_val;
@@ -2614,7 +2614,7 @@ void npc::npc_update_body()
     }
 }
 
-void npc::on_load()
+time_duration npc::catch_up( const time_duration &finest_step )
 {
     const auto advance_effects = [&]( const time_duration & elapsed_dur ) {
         for( auto &elem : *effects ) {
@@ -2631,34 +2631,60 @@ void npc::on_load()
             }
         }
     };
-    // Cap at some reasonable number, say 2 days
-    const time_duration dt = std::min( calendar::turn - last_updated, 2_days );
+    if( absent_since == calendar::before_time_starts ) {
+        absent_since = last_updated;
+    }
+    // Cap the whole absence at some reasonable number, say 2 days,
+    // no matter how many offscreen updates it is split over
+    const time_point end = std::min( calendar::turn, absent_since + 2_days );
+    const time_point start = last_updated;
     // TODO: Sleeping, healing etc.
-    last_updated = calendar::turn;
-    time_point cur = calendar::turn - dt;
-    add_msg( m_debug, "on_load() by %s, %d turns", name, to_turns<int>( dt ) );
+    time_point cur = start;
     // First update with 30 minute granularity, then 5 minutes, then turns
-    for( ; cur < calendar::turn - 30_minutes; cur += 30_minutes + 1_turns ) {
+    for( ; cur < end - 30_minutes; cur += 30_minutes + 1_turns ) {
         update_body( cur, cur + 30_minutes );
         advance_effects( 30_minutes );
     }
-    for( ; cur < calendar::turn - 5_minutes; cur += 5_minutes + 1_turns ) {
+    for( ; finest_step <= 5_minutes && cur < end - 5_minutes; cur += 5_minutes + 1_turns ) {
         update_body( cur, cur + 5_minutes );
         advance_effects( 5_minutes );
     }
-    for( ; cur < calendar::turn; cur += 1_turns ) {
+    for( ; finest_step <= 1_turns && cur < end; cur += 1_turns ) {
         update_body( cur, cur + 1_turns );
         process_effects();
     }
+    last_updated = std::max( start, std::min( cur, end ) );
+    const time_duration dt = last_updated - start;
+    if( finest_step <= 1_turns ) {
+        // Caught up, whatever is left over the cap is skipped
+        last_updated = calendar::turn;
+        absent_since = calendar::before_time_starts;
+    }
 
-    if( dt > 0_turns ) {
+    // give NPCs that are doing activities a pile of moves
+    if( dt > 0_turns && ( has_destination() || activity ) ) {
+        mod_moves( to_moves<int>( dt ) );
+    }
+    return dt;
+}
+
+void npc::update_offscreen()
+{
+    if( calendar::turn - last_updated > 30_minutes ) {
+        catch_up( 30_minutes );
+    }
+}
+
+void npc::on_load()
+{
+    const bool was_away = last_updated < calendar::turn;
+    const time_duration dt = catch_up( 1_turns );
+    add_msg( m_debug, "on_load() by %s, %d turns", name, to_turns<int>( dt ) );
+
+    if( was_away ) {
         // This ensures food is properly rotten at load
         // Otherwise NPCs try to eat rotten food and fail
         process_active_items();
-        // give NPCs that are doing activities a pile of moves
-        if( has_destination() || activity ) {
-            mod_moves( to_moves<int>( dt ) );
-        }
     }
 
     // Not necessarily true, but it's not a bad idea to set this
@@ -507,6 +507,35 @@ struct healing_options {
     void set_all();
 };
 
+// Monsters npc::assess_danger looks at, sorted out ahead of time by gather_danger_candidates
+struct npc_danger_candidates {
+    // Only used during this turn
+    time_point turn = calendar::before_time_starts;
+    // Monsters friendly to the NPC, they may have died or been removed since
+    std::vector<std::weak_ptr<monster>> friends;
+    // Monsters hostile to the NPC, or that the NPC is hostile to
+    std::vector<std::weak_ptr<monster>> threats;
+};
+
+// What npc::move compares to see whether anything happened since an NPC decided to stay put
+struct npc_calm_state {
+    tripoint pos;
+    int hp = 0;
+    size_t inventory_stacks = 0;
+    size_t worn_items = 0;
+    itype_id weapon;
+    npc_attitude attitude = NPCATT_NULL;
+    npc_mission mission = NPC_MISSION_NULL;
+    combat_engagement engagement = ENGAGE_NONE;
+    ally_rule rule_flags = ally_rule::DEFAULT;
+    ally_rule rule_overrides = ally_rule::DEFAULT;
+
+    bool operator==( const npc_calm_state &rhs ) const;
+    bool operator!=( const npc_calm_state &rhs ) const {
+        return !( *this == rhs );
+    }
+};
+
 // Data relevant only for this action
 struct npc_short_term_cache {
     float danger;
@@ -534,6 +563,21 @@ struct npc_short_term_cache {
     std::map<direction, float> threat_map;
     // Cache of locations the NPC has searched recently in npc::find_item()
     lru_cache<tripoint, int> searched_tiles;
+
+    // NPCs can move several times per turn, these only get recomputed once per turn
+    // (or when the inputs noted next to them change) by npc::regen_ai_cache.
+    time_point context_turn = calendar::before_time_starts;
+    // dangerous_explosives are as seen from here, on this turn
+    tripoint dangerous_explosives_pos = tripoint_min;
+    time_point dangerous_explosives_turn = calendar::before_time_starts;
+    // The avatar's followers
+    std::vector<std::weak_ptr<npc>> followers;
+    // Used instead of all monsters by the first npc::assess_danger this turn
+    npc_danger_candidates danger_candidates;
+    // npc::move keeps pausing without thinking it over again until this turn, unless
+    // something changes (see npc::keeps_calm_decision)
+    time_point calm_until = calendar::before_time_starts;
+    npc_calm_state calm_state;
 };
 
 // DO NOT USE! This is old, use strings as talk topic instead, e.g. "TALK_AGREE_FOLLOW" instead of
@@ -1032,6 +1076,30 @@ class npc : public player
         float evaluate_enemy( const Creature &target ) const;
 
         void assess_danger();
+        /** Forgets a calm decision to stay put, so the next @ref move thinks everything over. */
+        void invalidate_calm_decision();
+        /** Our situation as far as staying calm is concerned. */
+        npc_calm_state calm_state() const;
+        /**
+         * Whether the last decision of @ref move was to stay put with nothing around, and
+         * nothing happened since: no new hostile in sight, no damage taken, no sound alert,
+         * no inventory, attitude, mission or rule change, no fire or explosive nearby.
+         */
+        bool keeps_calm_decision();
+        /**
+         * Remembers @p action as a calm decision, if it is one. Not for attitudes that
+         * depend on what the avatar does, like leading or talking to them.
+         */
+        void remember_calm_decision( npc_action action );
+        /**
+         * Sorts @p critters into friends and possible threats by their attitude to us, the
+         * way @ref assess_danger does. Only reads NPC and monster state, so it is safe to
+         * call for different NPCs from several threads at once.
+         */
+        npc_danger_candidates danger_candidates(
+            const std::vector<std::shared_ptr<monster>> &critters ) const;
+        /** The first @ref assess_danger this turn uses these instead of going over all monsters. */
+        void set_danger_candidates( npc_danger_candidates &&candidates );
         // Functions which choose an action for a particular goal
         npc_action method_of_fleeing();
         npc_action method_of_attack();
@@ -1079,9 +1147,11 @@ class npc : public player
          * @param p Destination of pathing
          * @param no_bashing Don't allow pathing through tiles that require bashing.
          * @param force If there is no valid path, empty the current path.
+         * @param adjacent If p can't be entered, path to the cheapest passable tile next to it.
          * @returns If it updated the path.
          */
-        bool update_path( const tripoint &p, bool no_bashing = false, bool force = true );
+        bool update_path( const tripoint &p, bool no_bashing = false, bool force = true,
+                          bool adjacent = false );
         bool can_open_door( const tripoint &p, bool inside ) const;
         bool can_move_to( const tripoint &p, bool no_bashing = false ) const;
 
@@ -1296,6 +1366,16 @@ class npc : public player
         static constexpr tripoint no_goal_point = tripoint_min;
 
         time_point last_updated;
+        /** @ref last_updated when the NPC was last in the reality bubble, while it is away. */
+        time_point absent_since = calendar::before_time_starts;
+        /**
+         * Updates body and effects from @ref last_updated towards now, in steps of 30 minutes,
+         * then 5 minutes, then single turns, but none finer than @p finest_step.
+         * Only the first two days since @ref absent_since are simulated. Once caught up to
+         * the turn, the rest of a longer absence is skipped and the absence is over.
+         * Returns how much time was simulated.
+         */
+        time_duration catch_up( const time_duration &finest_step );
         /**
          * Do some cleanup and caching as npc is being unloaded from map.
          */
@@ -1304,6 +1384,11 @@ class npc : public player
          * Retroactively update npc.
          */
         void on_load();
+        /**
+         * Advances needs, body and effects of an NPC outside the reality bubble in 30 minute
+         * steps, so that @ref on_load only has the last few minutes left to catch up on.
+         */
+        void update_offscreen();
         /**
          * Update body, but throttled.
          */
@@ -1342,6 +1427,8 @@ class npc : public player
         bool could_move_onto( const tripoint &p ) const;
 
         std::vector<sphere> find_dangerous_explosives() const;
+        /** Refreshes ai_cache.dangerous_explosives once per turn, or when we moved. */
+        void update_dangerous_explosives();
 
         npc_companion_mission comp_mission;
 };
@@ -1391,6 +1478,13 @@ struct epilogue {
 
 std::ostream &operator<< ( std::ostream &os, const npc_need &need );
 
+/**
+ * Calls @ref npc::danger_candidates for each of @p npcs, split over worker threads when
+ * there are enough NPCs and monsters. The result is in the same order as @p npcs.
+ */
+std::vector<npc_danger_candidates> gather_danger_candidates( const std::vector<npc *> &npcs,
+        const std::vector<std::shared_ptr<monster>> &critters );
+
 /** Opens a menu and allows player to select a friendly NPC. */
 npc *pick_follower();
 
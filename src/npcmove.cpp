@@ -3,8 +3,10 @@
 #include <climits>
 #include <cstdlib>
 #include <algorithm>
+#include <bitset>
 #include <memory>
 #include <numeric>
+#include <set>
 #include <sstream>
 #include <iterator>
 #include <tuple>
@@ -14,6 +16,8 @@
 #include "avatar.h"
 #include "bionics.h"
 #include "cata_algo.h"
+#include "cata_parallel.h"
+#include "creature_tracker.h"
 #include "clzones.h"
 #include "coordinate_conversions.h"
 #include "debug.h"
@@ -33,6 +37,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npctalk.h"
+#include "optional.h"
 #include "options.h"
 #include "overmap_location.h"
 #include "overmapbuffer.h"
@@ -332,6 +337,16 @@ std::vector<sphere> npc::find_dangerous_explosives() const
     return result;
 }
 
+void npc::update_dangerous_explosives()
+{
+    if( ai_cache.dangerous_explosives_turn != calendar::turn ||
+        ai_cache.dangerous_explosives_pos != pos() ) {
+        ai_cache.dangerous_explosives = find_dangerous_explosives();
+        ai_cache.dangerous_explosives_turn = calendar::turn;
+        ai_cache.dangerous_explosives_pos = pos();
+    }
+}
+
 float npc::evaluate_enemy( const Creature &target ) const
 {
     if( target.is_monster() ) {
@@ -351,6 +366,43 @@ static bool too_close( const tripoint &critter_pos, const tripoint &ally_pos, co
     return rl_dist( critter_pos, ally_pos ) <= def_radius;
 }
 
+npc_danger_candidates npc::danger_candidates(
+    const std::vector<std::shared_ptr<monster>> &critters ) const
+{
+    npc_danger_candidates ret;
+    ret.turn = calendar::turn;
+    for( const std::shared_ptr<monster> &critter : critters ) {
+        const Attitude att = critter->attitude_to( *this );
+        if( att == A_FRIENDLY ) {
+            ret.friends.emplace_back( critter );
+        } else if( att == A_HOSTILE || ( !critter->friendly && is_enemy() ) ) {
+            ret.threats.emplace_back( critter );
+        }
+    }
+    return ret;
+}
+
+void npc::set_danger_candidates( npc_danger_candidates &&candidates )
+{
+    ai_cache.danger_candidates = std::move( candidates );
+}
+
+std::vector<npc_danger_candidates> gather_danger_candidates( const std::vector<npc *> &npcs,
+        const std::vector<std::shared_ptr<monster>> &critters )
+{
+    std::vector<npc_danger_candidates> result( npcs.size() );
+    // Not worth starting threads unless there are plenty of NPC and monster pairs
+    static constexpr size_t min_pairs_per_thread = 2048;
+    const size_t min_npcs_per_thread = ( min_pairs_per_thread + critters.size() ) /
+                                       ( critters.size() + 1 );
+    parallel_slices( npcs.size(), min_npcs_per_thread, [&]( size_t begin, size_t end ) {
+        for( size_t i = begin; i < end; ++i ) {
+            result[i] = npcs[i]->danger_candidates( critters );
+        }
+    } );
+    return result;
+}
+
 void npc::assess_danger()
 {
     float assessment = 0.0f;
@@ -434,15 +486,35 @@ void npc::assess_danger()
         }
     }
 
-    for( const monster &critter : g->all_monsters() ) {
-        auto att = critter.attitude_to( *this );
-        if( att == A_FRIENDLY ) {
-            ai_cache.friends.emplace_back( g->shared_from( critter ) );
-            continue;
-        }
-        if( att != A_HOSTILE && ( critter.friendly || !is_enemy() ) ) {
-            continue;
+    // Candidates gathered before the NPCs started moving are used once, for the
+    // first assessment this turn. They may have died or left since then.
+    npc_danger_candidates candidates;
+    if( ai_cache.danger_candidates.turn == calendar::turn ) {
+        candidates = std::move( ai_cache.danger_candidates );
+        const auto gone = []( const std::weak_ptr<monster> &candidate ) {
+            const std::shared_ptr<monster> critter = candidate.lock();
+            return !critter || critter->is_dead() ||
+                   g->critter_tracker->find_unowned( critter->pos() ) != critter.get();
+        };
+        candidates.friends.erase( std::remove_if( candidates.friends.begin(),
+                                  candidates.friends.end(), gone ), candidates.friends.end() );
+        candidates.threats.erase( std::remove_if( candidates.threats.begin(),
+                                  candidates.threats.end(), gone ), candidates.threats.end() );
+    } else {
+        std::vector<std::shared_ptr<monster>> critters;
+        for( monster &critter : g->all_monsters() ) {
+            critters.push_back( g->shared_from( critter ) );
         }
+        candidates = danger_candidates( critters );
+    }
+    ai_cache.danger_candidates = npc_danger_candidates();
+    for( const std::weak_ptr<monster> &critter : candidates.friends ) {
+        ai_cache.friends.emplace_back( critter );
+    }
+
+    for( const std::weak_ptr<monster> &candidate : candidates.threats ) {
+        const std::shared_ptr<monster> critter_ptr = candidate.lock();
+        const monster &critter = *critter_ptr;
         if( !sees( critter ) ) {
             continue;
         }
@@ -643,8 +715,18 @@ void npc::regen_ai_cache()
     ai_cache.can_heal.clear_all();
     ai_cache.danger = 0.0f;
     ai_cache.total_danger = 0.0f;
+    const bool new_turn = ai_cache.context_turn != calendar::turn;
+    ai_cache.context_turn = calendar::turn;
     ai_cache.my_weapon_value = weapon_value( weapon );
-    ai_cache.dangerous_explosives = find_dangerous_explosives();
+    update_dangerous_explosives();
+    if( new_turn ) {
+        ai_cache.followers.clear();
+        for( const character_id &id : g->get_follower_list() ) {
+            if( std::shared_ptr<npc> follower = overmap_buffer.find_npc( id ) ) {
+                ai_cache.followers.emplace_back( follower );
+            }
+        }
+    }
 
     assess_danger();
     if( old_assessment > NPC_DANGER_VERY_LOW && ai_cache.danger_assessment <= 0 ) {
@@ -673,6 +755,98 @@ void npc::regen_ai_cache()
     }
 }
 
+bool npc_calm_state::operator==( const npc_calm_state &rhs ) const
+{
+    return pos == rhs.pos && hp == rhs.hp && inventory_stacks == rhs.inventory_stacks &&
+           worn_items == rhs.worn_items && weapon == rhs.weapon && attitude == rhs.attitude &&
+           mission == rhs.mission && engagement == rhs.engagement && rule_flags == rhs.rule_flags &&
+           rule_overrides == rhs.rule_overrides;
+}
+
+npc_calm_state npc::calm_state() const
+{
+    npc_calm_state ret;
+    ret.pos = pos();
+    ret.hp = get_hp();
+    ret.inventory_stacks = inv.size();
+    ret.worn_items = worn.size();
+    ret.weapon = weapon.typeId();
+    ret.attitude = attitude;
+    ret.mission = mission;
+    ret.engagement = rules.engagement;
+    ret.rule_flags = rules.flags;
+    ret.rule_overrides = rules.overrides;
+    return ret;
+}
+
+void npc::invalidate_calm_decision()
+{
+    ai_cache.calm_until = calendar::before_time_starts;
+}
+
+void npc::remember_calm_decision( npc_action action )
+{
+    // Needs change slowly enough to only be checked every now and then
+    static const time_duration calm_replan_interval = 30_turns;
+    // These react to the avatar, who isn't part of the calm state
+    static const std::set<npc_attitude> avatar_attitudes = {
+        NPCATT_LEAD, NPCATT_WAIT_FOR_LEAVE, NPCATT_TALK, NPCATT_MUG, NPCATT_RECOVER_GOODS
+    };
+    if( action != npc_pause || avatar_attitudes.count( attitude ) || is_enemy() ||
+        current_target() != nullptr ||
+        ai_cache.total_danger > 0.0f || !ai_cache.sound_alerts.empty() || ai_cache.guard_pos ||
+        !ai_cache.dangerous_explosives.empty() || has_effect( effect_npc_run_away ) ||
+        has_effect( effect_npc_fire_bad ) || activity ) {
+        invalidate_calm_decision();
+        return;
+    }
+    ai_cache.calm_until = calendar::turn + calm_replan_interval;
+    ai_cache.calm_state = calm_state();
+}
+
+bool npc::keeps_calm_decision()
+{
+    // Camp jobs get handed out on these turns
+    if( calendar::turn >= ai_cache.calm_until || calendar::once_every( 30_minutes ) ) {
+        return false;
+    }
+    if( !ai_cache.sound_alerts.empty() || calm_state() != ai_cache.calm_state ||
+        has_effect( effect_onfire ) || sees_dangerous_field( pos() ) ) {
+        return false;
+    }
+    // Shared with regen_ai_cache, in case we do end up thinking it over
+    update_dangerous_explosives();
+    if( !ai_cache.dangerous_explosives.empty() ) {
+        return false;
+    }
+    // Only submaps that have fields at all need a closer look
+    const std::bitset<MAPSIZE *MAPSIZE> &field_submaps = g->m.access_cache( posz() ).field_cache;
+    for( const tripoint &pt : g->m.points_in_radius( pos(), 6 ) ) {
+        if( field_submaps[pt.x / SEEX + pt.y / SEEY * MAPSIZE] &&
+            g->m.get_field( pt, fd_fire ) != nullptr ) {
+            return false;
+        }
+    }
+    // Anything hostile that could be in sight, see Creature::sees and player::sees
+    const int sight_radius = std::max( { sight_range( default_daylight_level() ), sight_range( 0 ),
+                                         clairvoyance(), 3
+                                       } );
+    for( const monster *critter : g->critter_tracker->monsters_in_radius( pos(), sight_radius,
+            fov_3d ? sight_radius : 0 ) ) {
+        if( critter->attitude_to( *this ) == A_HOSTILE ) {
+            return false;
+        }
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        if( &guy != this && rl_dist( pos(), guy.pos() ) <= sight_radius &&
+            !has_faction_relationship( guy, npc_factions::watch_your_back ) &&
+            attitude_to( guy ) != A_NEUTRAL ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void npc::move()
 {
     if( attitude == NPCATT_FLEE ) {
@@ -680,6 +854,12 @@ void npc::move()
     } else if( attitude == NPCATT_FLEE_TEMP && !has_effect( effect_npc_flee_player ) ) {
         set_attitude( NPCATT_NULL );
     }
+    // Idle NPCs with nothing around don't think everything over on every move
+    if( keeps_calm_decision() ) {
+        add_msg( m_debug, "%s stays put.", name );
+        execute_action( npc_pause );
+        return;
+    }
     regen_ai_cache();
     adjust_power_cbms();
 
@@ -907,6 +1087,7 @@ void npc::move()
     }
 
     add_msg( m_debug, "%s chose action %s.", name, npc_action_name( action ) );
+    remember_calm_decision( action );
     execute_action( action );
 }
 
@@ -2112,9 +2293,26 @@ void npc::aim()
     }
 }
 
-bool npc::update_path( const tripoint &p, const bool no_bashing, bool force )
+bool npc::update_path( const tripoint &p, const bool no_bashing, bool force, bool adjacent )
 {
-    if( p == pos() ) {
+    std::vector<tripoint> goals;
+    if( !adjacent || g->m.passable( p ) ) {
+        goals.push_back( p );
+    } else {
+        for( const tripoint &pt : g->m.points_in_radius( p, 1 ) ) {
+            if( pt != p && g->m.passable( pt ) ) {
+                goals.push_back( pt );
+            }
+        }
+        if( goals.empty() ) {
+            return false;
+        }
+    }
+    const auto is_goal = [&goals]( const tripoint & pt ) {
+        return std::find( goals.begin(), goals.end(), pt ) != goals.end();
+    };
+
+    if( is_goal( pos() ) ) {
         path.clear();
         return true;
     }
@@ -2125,13 +2323,24 @@ bool npc::update_path( const tripoint &p, const bool no_bashing, bool force )
 
     if( !path.empty() ) {
         const tripoint &last = path[path.size() - 1];
-        if( last == p && ( path[0].z != posz() || rl_dist( path[0], pos() ) <= 1 ) ) {
+        if( is_goal( last ) && ( path[0].z != posz() || rl_dist( path[0], pos() ) <= 1 ) ) {
             // Our path already leads to that point, no need to recalculate
             return true;
         }
     }
 
-    auto new_path = g->m.route( pos(), p, get_pathfinding_settings( no_bashing ), get_path_avoid() );
+    std::vector<tripoint> new_path;
+    if( goals.size() == 1 ) {
+        new_path = g->m.route( pos(), goals.front(), get_pathfinding_settings( no_bashing ),
+                               get_path_avoid() );
+    } else {
+        // One search finds whichever of the goals is the cheapest to reach
+        std::vector<std::vector<tripoint>> routes = g->m.routes( pos(), goals,
+                get_pathfinding_settings( no_bashing ), 1, get_path_avoid() );
+        if( !routes.empty() ) {
+            new_path = std::move( routes.front() );
+        }
+    }
     if( new_path.empty() ) {
         if( !ai_cache.sound_alerts.empty() ) {
             ai_cache.sound_alerts.erase( ai_cache.sound_alerts.begin() );
@@ -2537,29 +2746,6 @@ void npc::move_pause()
     }
 }
 
-static cata::optional<tripoint> nearest_passable( const tripoint &p, const tripoint &closest_to )
-{
-    if( g->m.passable( p ) ) {
-        return p;
-    }
-
-    // We need to path to adjacent tile, not the exact one
-    // Let's pick the closest one to us that is passable
-    auto candidates = closest_tripoints_first( 1, p );
-    std::sort( candidates.begin(), candidates.end(), [ closest_to ]( const tripoint & l,
-    const tripoint & r ) {
-        return rl_dist( closest_to, l ) < rl_dist( closest_to, r );
-    } );
-    auto iter = std::find_if( candidates.begin(), candidates.end(), []( const tripoint & pt ) {
-        return g->m.passable( pt );
-    } );
-    if( iter != candidates.end() ) {
-        return *iter;
-    }
-
-    return cata::nullopt;
-}
-
 void npc::move_away_from( const std::vector<sphere> &spheres, bool no_bashing )
 {
     if( spheres.empty() ) {
@@ -2658,25 +2844,44 @@ void npc::find_item()
         return;
     }
 
+    // Only when the avatar has followers, NPCs won't take items the avatar or a follower
+    // could see them take. Who sees what doesn't change during the search, so the checks
+    // are done once for our position and once per position of the best item so far.
+    std::vector<std::shared_ptr<npc>> followers;
+    for( const std::weak_ptr<npc> &follower : ai_cache.followers ) {
+        if( std::shared_ptr<npc> guy = follower.lock() ) {
+            followers.push_back( guy );
+        }
+    }
+    const auto witnessed = [&followers]( const tripoint & p ) {
+        if( g->u.sees( p ) ) {
+            return true;
+        }
+        for( const std::shared_ptr<npc> &guy : followers ) {
+            if( guy->sees( p ) ) {
+                return true;
+            }
+        }
+        return false;
+    };
+    const bool witnessed_here = !followers.empty() && witnessed( pos() );
+    cata::optional<tripoint> witness_checked_pos;
+    bool witnessed_there = false;
+
     const auto consider_item =
-        [&wanted, &best_value, whitelisting, volume_allowed, weight_allowed, this]
+        [&wanted, &best_value, whitelisting, volume_allowed, weight_allowed, this, &followers,
+         &witnessed, witnessed_here, &witness_checked_pos, &witnessed_there]
     ( const item & it, const tripoint & p ) {
         if( it.made_of_from_type( LIQUID ) ) {
             // Don't even consider liquids.
             return;
         }
-        std::vector<npc *> followers;
-        for( auto &elem : g->get_follower_list() ) {
-            std::shared_ptr<npc> npc_to_get = overmap_buffer.find_npc( elem );
-            if( !npc_to_get ) {
-                continue;
+        if( !followers.empty() && !it.is_owned_by( *this, true ) ) {
+            if( !witness_checked_pos || *witness_checked_pos != wanted_item_pos ) {
+                witness_checked_pos = wanted_item_pos;
+                witnessed_there = witnessed( wanted_item_pos );
             }
-            npc *npc_to_add = npc_to_get.get();
-            followers.push_back( npc_to_add );
-        }
-        for( auto &elem : followers ) {
-            if( !it.is_owned_by( *this, true ) && ( g->u.sees( this->pos() ) || g->u.sees( wanted_item_pos ) ||
-                                                    elem->sees( this->pos() ) || elem->sees( wanted_item_pos ) ) ) {
+            if( witnessed_here || witnessed_there ) {
                 return;
             }
         }
@@ -2791,12 +2996,9 @@ void npc::find_item()
 
     fetching_item = true;
 
-    // TODO: Move that check above, make it multi-target pathing and use it
-    // to limit tiles available for choice of items
+    // TODO: Move that check above and use it to limit tiles available for choice of items
     const int dist_to_item = rl_dist( wanted_item_pos, pos() );
-    if( const cata::optional<tripoint> dest = nearest_passable( wanted_item_pos, pos() ) ) {
-        update_path( *dest );
-    }
+    update_path( wanted_item_pos, false, true, true );
 
     if( path.empty() && dist_to_item > 1 ) {
         // Item not reachable, let's just totally give up for now
@@ -2838,9 +3040,7 @@ void npc::pick_up_item()
 
     add_msg( m_debug, "%s::pick_up_item(); [%d, %d, %d] => [%d, %d, %d]", name,
              posx(), posy(), posz(), wanted_item_pos.x, wanted_item_pos.y, wanted_item_pos.z );
-    if( const cata::optional<tripoint> dest = nearest_passable( wanted_item_pos, pos() ) ) {
-        update_path( *dest );
-    }
+    update_path( wanted_item_pos, false, true, true );
 
     const int dist_to_pickup = rl_dist( pos(), wanted_item_pos );
     if( dist_to_pickup > 1 && !path.empty() ) {
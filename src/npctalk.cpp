@@ -104,7 +104,7 @@ static const itype_id fuel_type_animal( "animal" );
 const zone_type_id zone_no_investigate( "NPC_NO_INVESTIGATE" );
 const zone_type_id zone_investigate_only( "NPC_INVESTIGATE_ONLY" );
 
-static std::map<std::string, json_talk_topic> json_talk_topics;
+static std::unordered_map<std::string, json_talk_topic> json_talk_topics;
 
 // Every OWED_VAL that the NPC owes you counts as +1 towards convincing
 #define OWED_VAL 1000
@@ -1066,7 +1066,7 @@ void dialogue::apply_speaker_effects( const talk_topic &the_topic )
     if( iter == json_talk_topics.end() ) {
         return;
     }
-    for( json_dynamic_line_effect &npc_effect : iter->second.get_speaker_effects() ) {
+    for( const json_dynamic_line_effect &npc_effect : iter->second.get_speaker_effects() ) {
         if( npc_effect.test_condition( *this ) ) {
             npc_effect.apply( *this );
         }
@@ -2797,7 +2797,10 @@ void json_talk_response::load_condition( JsonObject &jo )
 {
     is_switch = jo.get_bool( "switch", false );
     is_default = jo.get_bool( "default", false );
-    read_condition<dialogue>( jo, "condition", condition, true );
+    // Responses without a condition are always shown, leave it empty so it isn't even called.
+    if( jo.has_member( "condition" ) ) {
+        read_condition<dialogue>( jo, "condition", condition, true );
+    }
 }
 
 bool json_talk_response::test_condition( const dialogue &d ) const
@@ -2808,15 +2811,18 @@ bool json_talk_response::test_condition( const dialogue &d ) const
     return true;
 }
 
-bool json_talk_response::gen_responses( dialogue &d, bool switch_done ) const
+bool json_talk_response::selected( const dialogue &d, bool &switch_done ) const
 {
-    if( !is_switch || !switch_done ) {
-        if( test_condition( d ) ) {
-            d.responses.emplace_back( actual_response );
-            return is_switch && !is_default;
-        }
+    if( ( is_switch && switch_done ) || !test_condition( d ) ) {
+        return false;
     }
-    return false;
+    switch_done |= is_switch && !is_default;
+    return true;
+}
+
+const talk_response &json_talk_response::get_response() const
+{
+    return actual_response;
 }
 
 // repeat responses always go in front
@@ -3059,11 +3065,19 @@ void json_talk_topic::load( JsonObject &jo )
 
 bool json_talk_topic::gen_responses( dialogue &d ) const
 {
-    d.responses.reserve( responses.size() ); // A wild guess, can actually be more or less
-
+    // Test all conditions first, so only the chosen responses are copied, into storage
+    // allocated once.
+    std::vector<const talk_response *> chosen;
+    chosen.reserve( responses.size() );
     bool switch_done = false;
-    for( auto &r : responses ) {
-        switch_done |= r.gen_responses( d, switch_done );
+    for( const json_talk_response &r : responses ) {
+        if( r.selected( d, switch_done ) ) {
+            chosen.push_back( &r.get_response() );
+        }
+    }
+    d.responses.reserve( d.responses.size() + chosen.size() );
+    for( const talk_response *r : chosen ) {
+        d.responses.emplace_back( *r );
     }
     for( const json_talk_repeat_response &repeat : repeat_responses ) {
         player *actor = d.alpha;
@@ -3099,7 +3113,7 @@ std::string json_talk_topic::get_dynamic_line( const dialogue &d ) const
     return dynamic_line( d );
 }
 
-std::vector<json_dynamic_line_effect> json_talk_topic::get_speaker_effects() const
+const std::vector<json_dynamic_line_effect> &json_talk_topic::get_speaker_effects() const
 {
     return speaker_effects;
 }
@@ -1906,6 +1906,11 @@ void options_manager::add_options_debug()
 
     get_option( "FOV_3D_Z_RANGE" ).setPrerequisite( "FOV_3D" );
 
+    add( "SOUND_ATTENUATION", "debug", translate_marker( "Experimental sound attenuation" ),
+         translate_marker( "If true, sounds heard by monsters get quieter for every wall and floor between the monster and the source." ),
+         false
+       );
+
     add( "ENCODING_CONV", "debug", translate_marker( "Experimental path name encoding conversion" ),
          translate_marker( "If true, file path names are going to be transcoded from system encoding to UTF-8 when reading and will be transcoded back when writing.  Mainly for CJK Windows users." ),
          true
@@ -84,6 +84,7 @@ overmap &overmapbuffer::get( const point &p )
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     new_om.populate();
+    index_npcs( new_om );
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
     fix_mongroups( new_om );
@@ -101,8 +102,27 @@ void overmapbuffer::create_custom_overmap( const point &p, overmap_special_batch
             last_requested_overmap = nullptr;
         }
     }
-    overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
+    std::unique_ptr<overmap> &slot = overmaps[ p ];
+    if( slot ) {
+        unindex_npcs( *slot );
+    }
+    overmap &new_om = *( slot = std::make_unique<overmap>( p ) );
     new_om.populate( specials );
+    index_npcs( new_om );
+}
+
+void overmapbuffer::index_npcs( const overmap &om )
+{
+    for( const std::shared_ptr<npc> &guy : om.get_npcs() ) {
+        npc_index[guy->getID()] = guy;
+    }
+}
+
+void overmapbuffer::unindex_npcs( const overmap &om )
+{
+    for( const std::shared_ptr<npc> &guy : om.get_npcs() ) {
+        npc_index.erase( guy->getID() );
+    }
 }
 
 void overmapbuffer::fix_mongroups( overmap &new_overmap )
@@ -197,6 +217,7 @@ void overmapbuffer::save()
 void overmapbuffer::clear()
 {
     overmaps.clear();
+    npc_index.clear();
     known_non_existing.clear();
     last_requested_overmap = nullptr;
 }
@@ -992,12 +1013,11 @@ tripoint overmapbuffer::find_random( const tripoint &origin, const std::string &
 
 std::shared_ptr<npc> overmapbuffer::find_npc( character_id id )
 {
-    for( auto &it : overmaps ) {
-        if( auto p = it.second->find_npc( id ) ) {
-            return p;
-        }
+    const auto iter = npc_index.find( id );
+    if( iter == npc_index.end() ) {
+        return nullptr;
     }
-    return nullptr;
+    return iter->second.lock();
 }
 
 cata::optional<basecamp *> overmapbuffer::find_camp( const point &p )
@@ -1016,10 +1036,12 @@ void overmapbuffer::insert_npc( const std::shared_ptr<npc> &who )
     const tripoint npc_omt_pos = who->global_omt_location();
     const point npc_om_pos = omt_to_om_copy( npc_omt_pos.xy() );
     get( npc_om_pos ).insert_npc( who );
+    npc_index[who->getID()] = who;
 }
 
 std::shared_ptr<npc> overmapbuffer::remove_npc( const character_id &id )
 {
+    npc_index.erase( id );
     for( auto &it : overmaps ) {
         if( const auto p = it.second->erase_npc( id ) ) {
             return p;
@@ -1330,7 +1352,7 @@ void overmapbuffer::spawn_monster( const tripoint &p )
         // The monster position must be local to the main map when added to the game
         const tripoint local = tripoint( g->m.getlocal( ms ), p.z );
         assert( g->m.inbounds( local ) );
-        monster *const placed = g->place_critter_at( std::make_shared<monster>( this_monster ), local );
+        monster *const placed = g->place_critter_at( make_shared_monster( this_monster ), local );
         if( placed ) {
             placed->on_load();
         }
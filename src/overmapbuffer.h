@@ -11,6 +11,7 @@
 #include <string>
 #include <utility>
 
+#include "character_id.h"
 #include "enums.h"
 #include "omdata.h"
 #include "overmap_types.h"
@@ -242,7 +243,7 @@ class overmapbuffer
         /**
          * Find the npc with the given ID.
          * Returns NULL if the npc could not be found.
-         * Searches all loaded overmaps.
+         * Covers all loaded overmaps, through @ref npc_index.
          */
         std::shared_ptr<npc> find_npc( character_id id );
         /**
@@ -464,6 +465,14 @@ class overmapbuffer
         bool is_findable_location( const tripoint &location, const omt_find_params &params );
 
         std::unordered_map< point, std::unique_ptr< overmap > > overmaps;
+        /**
+         * Every NPC stored in one of the loaded @ref overmaps, by id. Maintained whenever
+         * NPCs enter or leave the buffer: loading or replacing an overmap, @ref insert_npc
+         * and @ref remove_npc. Moving an NPC between two loaded overmaps doesn't change it.
+         */
+        std::unordered_map<character_id, std::weak_ptr<npc>> npc_index;
+        void index_npcs( const overmap &om );
+        void unindex_npcs( const overmap &om );
         /**
          * Set of overmap coordinates of overmaps that are known
          * to not exist on disk. See @ref get_existing for usage.
@@ -5,6 +5,7 @@
 #include <queue>
 #include <set>
 #include <array>
+#include <bitset>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -12,6 +13,7 @@
 #include "cata_utility.h"
 #include "coordinates.h"
 #include "debug.h"
+#include "enums.h"
 #include "map.h"
 #include "mapdata.h"
 #include "optional.h"
@@ -24,6 +26,22 @@
 #include "type_id.h"
 #include "point.h"
 
+pathfinding_stats &get_pathfinding_stats()
+{
+    static thread_local pathfinding_stats stats;
+    return stats;
+}
+
+// Release builds leave the counters alone, they're only for benchmarks
+static void count_stat( long long pathfinding_stats::*stat )
+{
+#if !defined(RELEASE)
+    ( get_pathfinding_stats().*stat )++;
+#else
+    static_cast<void>( stat );
+#endif
+}
+
 enum astar_state {
     ASL_NONE,
     ASL_OPEN,
@@ -73,6 +91,7 @@ struct pathfinder {
 
         ptr = std::make_unique<path_data_layer>();
         ptr->init( min, max );
+        count_stat( &pathfinding_stats::layers_allocated );
         return *ptr;
     }
 
@@ -99,6 +118,7 @@ struct pathfinder {
         layer.parent[index] = from;
         layer.score [index] = score;
         open.push( std::make_pair( score, to ) );
+        count_stat( &pathfinding_stats::pushed );
     }
 
     void close_point( const tripoint &p ) {
@@ -114,6 +134,240 @@ struct pathfinder {
     }
 };
 
+// Tiles that need more than the flat ground cost calculation
+static constexpr pf_special non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP;
+
+// Jump point search state for a single z-level
+struct jump_point_layer {
+    // Tiles the search can never enter
+    std::bitset< MAPSIZE_X *MAPSIZE_Y > blocked;
+    // Flat ground tiles whose neighbors are all either flat ground or blocked
+    std::bitset< MAPSIZE_X *MAPSIZE_Y > calm;
+    int plain_count = 0;
+};
+
+/**
+ * Jump point search over the uniform cost parts of the search area.
+ * Runs of calm tiles are skipped over in straight or diagonal lines, only stopping
+ * where the optimal path could turn: next to blocked tiles (forced neighbors) or next to
+ * tiles that need the full cost calculation. The latter are expanded by regular A*.
+ */
+struct jump_point_search {
+    const map &m;
+    const pathfinding_settings &settings;
+    const std::set<tripoint> &pre_closed;
+    const std::set<tripoint> &targets;
+    tripoint from;
+    point min;
+    point max;
+    std::array< std::unique_ptr< jump_point_layer >, OVERMAP_LAYERS > layers;
+
+    jump_point_search( const map &m, const pathfinding_settings &settings,
+                       const std::set<tripoint> &pre_closed, const std::set<tripoint> &targets,
+                       const tripoint &from, const point &min, const point &max ) :
+        m( m ), settings( settings ), pre_closed( pre_closed ), targets( targets ), from( from ),
+        min( min ), max( max ) {
+    }
+
+    bool inbounds( const tripoint &p ) const {
+        return p.x >= min.x && p.x < max.x && p.y >= min.y && p.y < max.y;
+    }
+
+    // Same conditions under which A* closes an impassable tile without further checks
+    bool always_closed( const pf_special special ) const {
+        if( settings.avoid_rough_terrain ) {
+            return special & non_normal;
+        }
+        return ( special & PF_WALL ) && !( special & PF_VEHICLE ) && settings.bash_strength == 0 &&
+               !settings.allow_open_doors && settings.climb_cost <= 0;
+    }
+
+    jump_point_layer &get_layer( const int z ) {
+        std::unique_ptr< jump_point_layer > &ptr = layers[z + OVERMAP_DEPTH];
+        if( ptr != nullptr ) {
+            return *ptr;
+        }
+
+        ptr = std::make_unique<jump_point_layer>();
+        count_stat( &pathfinding_stats::layers_allocated );
+        jump_point_layer &layer = *ptr;
+        const pathfinding_cache &pf_cache = m.get_pathfinding_cache_ref( z );
+        std::bitset< MAPSIZE_X *MAPSIZE_Y > plain;
+        for( int x = min.x; x < max.x; x++ ) {
+            for( int y = min.y; y < max.y; y++ ) {
+                const pf_special special = pf_cache.special[x][y];
+                const int index = flat_index( x, y );
+                if( always_closed( special ) ) {
+                    layer.blocked.set( index );
+                } else if( !( special & ( non_normal | PF_UPDOWN ) ) ) {
+                    plain.set( index );
+                }
+            }
+        }
+        for( const tripoint &p : pre_closed ) {
+            if( p.z == z && inbounds( p ) && p != from && targets.count( p ) == 0 ) {
+                const int index = flat_index( p.x, p.y );
+                layer.blocked.set( index );
+                plain.reset( index );
+            }
+        }
+        for( const tripoint &p : targets ) {
+            if( p.z == z && inbounds( p ) ) {
+                // Jumps must stop next to targets so that regular A* can step onto them
+                const int index = flat_index( p.x, p.y );
+                layer.blocked.reset( index );
+                plain.reset( index );
+            }
+        }
+
+        layer.plain_count = plain.count();
+        for( int x = min.x; x < max.x; x++ ) {
+            for( int y = min.y; y < max.y; y++ ) {
+                if( !plain[flat_index( x, y )] ) {
+                    continue;
+                }
+                bool calm = true;
+                for( int dx = -1; dx <= 1 && calm; dx++ ) {
+                    for( int dy = -1; dy <= 1 && calm; dy++ ) {
+                        const tripoint p( x + dx, y + dy, z );
+                        calm = !inbounds( p ) || plain[flat_index( p.x, p.y )] ||
+                               layer.blocked[flat_index( p.x, p.y )];
+                    }
+                }
+                layer.calm.set( flat_index( x, y ), calm );
+            }
+        }
+
+        return layer;
+    }
+
+    // Whether enough of the search area is flat ground for jumps to pay off
+    bool worth_it() {
+        const int area = ( max.x - min.x ) * ( max.y - min.y );
+        return get_layer( from.z ).plain_count * 4 >= area * 3;
+    }
+
+    bool is_blocked( const tripoint &p ) {
+        return !inbounds( p ) || get_layer( p.z ).blocked[flat_index( p.x, p.y )];
+    }
+
+    bool is_calm( const tripoint &p ) {
+        return inbounds( p ) && get_layer( p.z ).calm[flat_index( p.x, p.y )];
+    }
+
+    // Number of steps from `p` in direction `dir` to the next jump point, 0 if there is none
+    int jump( const tripoint &p, const point &dir ) {
+        const bool diagonal = dir.x != 0 && dir.y != 0;
+        tripoint next = p;
+        for( int steps = 1; ; steps++ ) {
+            next += dir;
+            if( is_blocked( next ) ) {
+                return 0;
+            }
+            if( !is_calm( next ) ) {
+                return steps;
+            }
+            if( diagonal ) {
+                if( ( is_blocked( next + point( -dir.x, 0 ) ) && !is_blocked( next + point( -dir.x, dir.y ) ) ) ||
+                    ( is_blocked( next + point( 0, -dir.y ) ) && !is_blocked( next + point( dir.x, -dir.y ) ) ) ) {
+                    return steps;
+                }
+                if( jump( next, point( dir.x, 0 ) ) != 0 || jump( next, point( 0, dir.y ) ) != 0 ) {
+                    return steps;
+                }
+            } else {
+                const point side( dir.y, dir.x );
+                if( ( is_blocked( next + side ) && !is_blocked( next + side + dir ) ) ||
+                    ( is_blocked( next - side ) && !is_blocked( next - side + dir ) ) ) {
+                    return steps;
+                }
+            }
+        }
+    }
+
+    // Directions worth searching from calm `p` entered moving in direction `dir`
+    std::vector<point> successor_dirs( const tripoint &p, const point &dir ) {
+        std::vector<point> ret;
+        if( dir.x != 0 && dir.y != 0 ) {
+            ret.emplace_back( dir.x, 0 );
+            ret.emplace_back( 0, dir.y );
+            ret.push_back( dir );
+            if( is_blocked( p + point( -dir.x, 0 ) ) ) {
+                ret.emplace_back( -dir.x, dir.y );
+            }
+            if( is_blocked( p + point( 0, -dir.y ) ) ) {
+                ret.emplace_back( dir.x, -dir.y );
+            }
+        } else {
+            const point side( dir.y, dir.x );
+            ret.push_back( dir );
+            if( is_blocked( p + side ) ) {
+                ret.push_back( dir + side );
+            }
+            if( is_blocked( p - side ) ) {
+                ret.push_back( dir - side );
+            }
+        }
+        return ret;
+    }
+};
+
+/**
+ * Flood fill backwards from the target over every tile the forward search could possibly enter.
+ * It advances one tile per forward expansion, so when the target sits in a closed pocket
+ * the fill runs out of tiles long before A* gives up on the whole search area.
+ */
+struct reverse_flood_fill {
+    point min;
+    point max;
+    tripoint from;
+    std::bitset< MAPSIZE_X *MAPSIZE_Y > visited;
+    std::vector<tripoint> frontier;
+    bool reached_source = false;
+
+    reverse_flood_fill( const point &min, const point &max, const tripoint &from,
+                        const tripoint &target ) : min( min ), max( max ), from( from ) {
+        visited.set( flat_index( target.x, target.y ) );
+        frontier.push_back( target );
+    }
+
+    // True once the fill has shown the source can't reach the target
+    bool exhausted() const {
+        return !reached_source && frontier.empty();
+    }
+
+    template<typename Enterable>
+    void step( const Enterable &enterable ) {
+        if( reached_source || frontier.empty() ) {
+            return;
+        }
+
+        const tripoint cur = frontier.back();
+        frontier.pop_back();
+        for( int dx = -1; dx <= 1; dx++ ) {
+            for( int dy = -1; dy <= 1; dy++ ) {
+                const tripoint p( cur.x + dx, cur.y + dy, cur.z );
+                if( p.x < min.x || p.x >= max.x || p.y < min.y || p.y >= max.y ) {
+                    continue;
+                }
+                const int index = flat_index( p.x, p.y );
+                if( visited[index] ) {
+                    continue;
+                }
+                if( p == from ) {
+                    reached_source = true;
+                    frontier.clear();
+                    return;
+                }
+                if( enterable( p ) ) {
+                    visited.set( index );
+                    frontier.push_back( p );
+                }
+            }
+        }
+    }
+};
+
 // Modifies `t` to be a tile with `flag` in the overmap tile that `t` was originally on
 // return false if it could not find a suitable point
 template<ter_bitflags flag>
@@ -197,7 +451,6 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
     }
     // First, check for a simple straight line on flat ground
     // Except when the line contains a pre-closed tile - we need to do regular pathing then
-    static const auto non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP;
     if( f.z == t.z ) {
         const auto line_path = line_to( f, t );
         const auto &pf_cache = get_pathfinding_cache_ref( f.z );
@@ -218,6 +471,50 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         return ret;
     }
 
+    std::vector<std::vector<tripoint>> found = find_routes( f, { t }, settings, pre_closed, 1 );
+    if( !found.empty() ) {
+        ret = std::move( found.front() );
+    }
+    return ret;
+}
+
+std::vector<std::vector<tripoint>> map::routes( const tripoint &f,
+                                const std::vector<tripoint> &targets,
+                                const pathfinding_settings &settings, const size_t max_routes,
+                                const std::set<tripoint> &pre_closed ) const
+{
+    if( !inbounds( f ) ) {
+        return {};
+    }
+
+    std::vector<tripoint> in_range;
+    for( tripoint t : targets ) {
+        clip_to_bounds( t );
+        if( t != f && rl_dist( f, t ) <= settings.max_dist ) {
+            in_range.push_back( t );
+        }
+    }
+    if( in_range.empty() ) {
+        return {};
+    }
+
+    return find_routes( f, in_range, settings, pre_closed, max_routes );
+}
+
+std::vector<std::vector<tripoint>> map::find_routes( const tripoint &f,
+                                const std::vector<tripoint> &targets,
+                                const pathfinding_settings &settings,
+                                const std::set<tripoint> &pre_closed, const size_t max_routes ) const
+{
+    std::vector<std::vector<tripoint>> ret;
+    const std::set<tripoint> goals( targets.begin(), targets.end() );
+    // With a single target this is A*, with several it is Dijkstra, stopping at the nearest ones
+    const tripoint &first_goal = *goals.begin();
+    const bool single_goal = goals.size() == 1;
+    const auto estimate = [&]( const tripoint & p ) {
+        return single_goal ? 2 * rl_dist( p, first_goal ) : 0;
+    };
+
     int max_length = settings.max_length;
     int bash = settings.bash_strength;
     int climb_cost = settings.climb_cost;
@@ -226,12 +523,24 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
     bool roughavoid = settings.avoid_rough_terrain;
 
     const int pad = 16;  // Should be much bigger - low value makes pathfinders dumb!
-    int minx = std::min( f.x, t.x ) - pad;
-    int miny = std::min( f.y, t.y ) - pad;
-    int minz = std::min( f.z, t.z ); // TODO: Make this way bigger
-    int maxx = std::max( f.x, t.x ) + pad;
-    int maxy = std::max( f.y, t.y ) + pad;
-    int maxz = std::max( f.z, t.z ); // Same TODO: as above
+    int minx = f.x;
+    int miny = f.y;
+    int minz = f.z; // TODO: Make this way bigger
+    int maxx = f.x;
+    int maxy = f.y;
+    int maxz = f.z; // Same TODO: as above
+    for( const tripoint &t : goals ) {
+        minx = std::min( minx, t.x );
+        miny = std::min( miny, t.y );
+        minz = std::min( minz, t.z );
+        maxx = std::max( maxx, t.x );
+        maxy = std::max( maxy, t.y );
+        maxz = std::max( maxz, t.z );
+    }
+    minx -= pad;
+    miny -= pad;
+    maxx += pad;
+    maxy += pad;
     clip_to_bounds( minx, miny, minz );
     clip_to_bounds( maxx, maxy, maxz );
 
@@ -246,12 +555,58 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
 
     // Start and end must not be closed
     pf.unclose_point( f );
-    pf.unclose_point( t );
+    for( const tripoint &t : goals ) {
+        pf.unclose_point( t );
+    }
     pf.add_point( 0, 0, f, f );
 
+    // Most searches outside buildings cross open ground, where plain A* wastes its time
+    // expanding tiles that all lead to equally good paths
+    jump_point_search jps( *this, settings, pre_closed, goals, f, point( minx, miny ),
+                           point( maxx, maxy ) );
+    const bool use_jps = jps.worth_it();
+
+    // Conservative version of the checks below: false only for tiles A* would close on sight
+    const auto may_enter = [&]( const tripoint & p ) {
+        if( pre_closed.count( p ) != 0 ) {
+            return false;
+        }
+        const pf_special p_special = get_pathfinding_cache_ref( p.z ).special[p.x][p.y];
+        if( !( p_special & non_normal ) ) {
+            return true;
+        }
+        if( roughavoid ) {
+            return false;
+        }
+        if( !( p_special & PF_WALL ) || ( p_special & PF_VEHICLE ) || climb_cost > 0 ) {
+            return true;
+        }
+        const maptile &tile = maptile_at_internal( p );
+        const auto &terrain = tile.get_ter_t();
+        const auto &furniture = tile.get_furn_t();
+        if( doors && terrain.open && furniture.open ) {
+            return true;
+        }
+        return bash != 0 && bash_rating_internal( bash, furniture, terrain, false, nullptr, -1 ) > 0;
+    };
+    // When both ends share a z-level the search area is that level only, so stairs and ramps
+    // are out and a pocket around the target can only be entered through its edge.
+    // Dropping off a ledge is the exception: it leads below, from where a ramp can come back up.
+    const bool check_reachable = single_goal && f.z == first_goal.z &&
+                                 !( trapavoid && has_zlevels() );
+    reverse_flood_fill reverse( point( minx, miny ), point( maxx, maxy ), f, first_goal );
+
+    std::vector<tripoint> reached;
     bool done = false;
 
     do {
+        if( check_reachable ) {
+            reverse.step( may_enter );
+            if( reverse.exhausted() ) {
+                return ret;
+            }
+        }
+
         auto cur = pf.get_next();
 
         const int parent_index = flat_index( cur.x, cur.y );
@@ -262,16 +617,40 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         }
 
         if( layer.gscore[parent_index] > max_length ) {
-            // Shortest path would be too long, return empty vector
-            return std::vector<tripoint>();
+            // Shortest path to any remaining target would be too long
+            break;
         }
 
-        if( cur == t ) {
-            done = true;
-            break;
+        if( goals.count( cur ) != 0 ) {
+            reached.push_back( cur );
+            done = reached.size() == goals.size() || reached.size() == max_routes;
+            if( done ) {
+                break;
+            }
         }
 
         cur_state = ASL_CLOSED;
+        count_stat( &pathfinding_stats::expanded );
+
+        if( use_jps ) {
+            const tripoint &par = layer.parent[parent_index];
+            if( par.z == cur.z && par != cur && jps.is_calm( cur ) ) {
+                const point dir( sgn( cur.x - par.x ), sgn( cur.y - par.y ) );
+                for( const point &d : jps.successor_dirs( cur, dir ) ) {
+                    const int steps = jps.jump( cur, d );
+                    if( steps == 0 ) {
+                        continue;
+                    }
+                    const tripoint p = cur + d * steps;
+                    const int index = flat_index( p.x, p.y );
+                    const int newg = layer.gscore[parent_index] + steps * ( ( d.x != 0 && d.y != 0 ) ? 3 : 2 );
+                    if( layer.state[index] == ASL_NONE || newg < layer.gscore[index] ) {
+                        pf.add_point( newg, newg + estimate( p ), cur, p );
+                    }
+                }
+                continue;
+            }
+        }
 
         const auto &pf_cache = get_pathfinding_cache_ref( cur.z );
         const auto cur_special = pf_cache.special[cur.x][cur.y];
@@ -400,7 +779,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                     auto &layer = pf.get_layer( p.z - 1 );
                                     // From cur, not p, because we won't be walking on air
                                     pf.add_point( layer.gscore[parent_index] + 10,
-                                                  layer.score[parent_index] + 10 + 2 * rl_dist( below, t ),
+                                                  layer.score[parent_index] + 10 + estimate( below ),
                                                   cur, below );
                                 }
 
@@ -419,7 +798,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             // If not visited, add as open
             // If visited, add it only if we can do so with better score
             if( layer.state[index] == ASL_NONE || newg < layer.gscore[index] ) {
-                pf.add_point( newg, newg + 2 * rl_dist( p, t ), cur, p );
+                pf.add_point( newg, newg + estimate( p ), cur, p );
             }
         }
 
@@ -435,7 +814,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             if( vertical_move_destination<TFLAG_GOES_UP>( *this, dest ) ) {
                 auto &layer = pf.get_layer( dest.z );
                 pf.add_point( layer.gscore[parent_index] + 2,
-                              layer.score[parent_index] + 2 * rl_dist( dest, t ),
+                              layer.score[parent_index] + estimate( dest ),
                               cur, dest );
             }
         }
@@ -444,7 +823,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             if( vertical_move_destination<TFLAG_GOES_DOWN>( *this, dest ) ) {
                 auto &layer = pf.get_layer( dest.z );
                 pf.add_point( layer.gscore[parent_index] + 2,
-                              layer.score[parent_index] + 2 * rl_dist( dest, t ),
+                              layer.score[parent_index] + estimate( dest ),
                               cur, dest );
             }
         }
@@ -454,37 +833,53 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint above( cur.x + x_offset[it], cur.y + y_offset[it], cur.z + 1 );
                 pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( above, t ),
+                              layer.score[parent_index] + 4 + estimate( above ),
                               cur, above );
             }
         }
     } while( !done && !pf.empty() );
 
-    if( done ) {
-        ret.reserve( rl_dist( f, t ) * 2 );
+    for( const tripoint &t : reached ) {
+        std::vector<tripoint> path;
+        path.reserve( rl_dist( f, t ) * 2 );
         tripoint cur = t;
+        tripoint par = t;
+        bool jumped = false;
         // Just to limit max distance, in case something weird happens
-        for( int fdist = max_length; fdist != 0; fdist-- ) {
-            const int cur_index = flat_index( cur.x, cur.y );
-            const auto &layer = pf.get_layer( cur.z );
-            const tripoint &par = layer.parent[cur_index];
+        for( int fdist = max_length; fdist != 0 && !jumped; fdist-- ) {
             if( cur == f ) {
                 break;
             }
 
-            ret.push_back( cur );
-            // Jumps are acceptable on 1 z-level changes
-            // This is because stairs teleport the player too
-            if( rl_dist( cur, par ) > 1 && abs( cur.z - par.z ) != 1 ) {
-                debugmsg( "Jump in our route!  %d:%d:%d->%d:%d:%d",
-                          cur.x, cur.y, cur.z, par.x, par.y, par.z );
-                return ret;
+            path.push_back( cur );
+            if( cur == par ) {
+                const int cur_index = flat_index( cur.x, cur.y );
+                par = pf.get_layer( cur.z ).parent[cur_index];
+                // Jumps are acceptable on 1 z-level changes
+                // This is because stairs teleport the player too
+                // Jump points link to the previous jump point in a straight or diagonal line
+                const point delta = par.xy() - cur.xy();
+                const bool in_line = delta.x == 0 || delta.y == 0 || abs( delta.x ) == abs( delta.y );
+                if( rl_dist( cur, par ) > 1 && abs( cur.z - par.z ) != 1 &&
+                    ( cur.z != par.z || !in_line ) ) {
+                    debugmsg( "Jump in our route!  %d:%d:%d->%d:%d:%d",
+                              cur.x, cur.y, cur.z, par.x, par.y, par.z );
+                    jumped = true;
+                    continue;
+                }
             }
 
-            cur = par;
+            if( cur.z == par.z ) {
+                cur += point( sgn( par.x - cur.x ), sgn( par.y - cur.y ) );
+            } else {
+                cur = par;
+            }
         }
 
-        std::reverse( ret.begin(), ret.end() );
+        if( !jumped ) {
+            std::reverse( path.begin(), path.end() );
+        }
+        ret.push_back( std::move( path ) );
     }
 
     return ret;
@@ -68,4 +68,19 @@ struct pathfinding_settings {
           allow_open_doors( aod ), avoid_traps( at ), allow_climb_stairs( acs ), avoid_rough_terrain( art ) {}
 };
 
+/**
+ * Running totals of the work done by map::route() and map::routes() on this thread,
+ * for benchmarks. Builds with RELEASE defined don't count anything.
+ */
+struct pathfinding_stats {
+    // Tiles taken off the open list and expanded
+    long long expanded = 0;
+    // Entries pushed onto the open list
+    long long pushed = 0;
+    // Per z-level search buffers allocated
+    long long layers_allocated = 0;
+};
+
+pathfinding_stats &get_pathfinding_stats();
+
 #endif
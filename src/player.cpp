@@ -3265,6 +3265,11 @@ void player::process_one_effect( effect &it, bool is_new )
         }
     }
 
+    // Everything below is driven by mod data, effects without any only count down
+    if( !it.has_mod_data() ) {
+        return;
+    }
+
     // Handle health mod
     val = get_effect( "H_MOD", reduced );
     if( val != 0 ) {
@@ -1465,6 +1465,41 @@ class player : public Character
         /** smart pointer to targeting data stored for aiming the player's weapon across turns. */
         std::shared_ptr<targeting_data> tdata;
 
+        /** What weapon_value() reads from the evaluating character. */
+        struct weapon_value_stamp {
+            // SkillLevel::level_changes
+            int skill_changes = -1;
+            std::array<int, 4> stats = {{ 0, 0, 0, 0 }};
+            // Hands and arms
+            std::array<int, 4> encumbrance = {{ 0, 0, 0, 0 }};
+            int weapon_volume = 0;
+            size_t effects = 0;
+            size_t mutations = 0;
+            int active_bionics = 0;
+            bool underwater = false;
+
+            bool operator==( const weapon_value_stamp &rhs ) const;
+        };
+        /** What weapon_value() reads from the item, contents, flags and techniques are hashed. */
+        struct weapon_value_key {
+            const itype *type = nullptr;
+            const itype *ammo = nullptr;
+            int ammo_count = 0;
+            int ammo_remaining = 0;
+            int damage = 0;
+            int burnt = 0;
+            size_t details = 0;
+
+            bool operator==( const weapon_value_key &rhs ) const;
+            struct hash {
+                size_t operator()( const weapon_value_key &key ) const;
+            };
+        };
+        /** weapon_value() results, valid as long as weapon_value_stamped matches us. */
+        mutable std::unordered_map<weapon_value_key, double, weapon_value_key::hash>
+        weapon_value_memo;
+        mutable weapon_value_stamp weapon_value_stamped;
+
     protected:
 
         /** Subset of learned recipes. Needs to be mutable for lazy initialization. */
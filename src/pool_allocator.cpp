@@ -0,0 +1,45 @@
+#include "pool_allocator.h"
+
+#include <algorithm>
+
+namespace cata
+{
+
+block_pool::block_pool( const size_t block_size, const size_t blocks_per_slab ) :
+    blocks_per_slab( blocks_per_slab )
+{
+    // Every block has to be able to hold the free list link, and must keep the next
+    // block aligned.
+    const size_t align = alignof( std::max_align_t );
+    const size_t size = std::max( block_size, sizeof( free_block ) );
+    this->block_size = ( size + align - 1 ) / align * align;
+}
+
+void *block_pool::allocate()
+{
+    const lock_guard lock( locked );
+    if( free_list == nullptr ) {
+        // new[] of char is aligned for any fundamental type
+        slabs.emplace_back( new char[block_size * blocks_per_slab] );
+        char *const slab = slabs.back().get();
+        // Link the blocks so the first one is handed out first
+        for( size_t i = blocks_per_slab; i-- > 0; ) {
+            free_block *const block = new( slab + i * block_size ) free_block;
+            block->next = free_list;
+            free_list = block;
+        }
+    }
+    free_block *const block = free_list;
+    free_list = block->next;
+    return block;
+}
+
+void block_pool::deallocate( void *const block )
+{
+    const lock_guard lock( locked );
+    free_block *const freed = new( block ) free_block;
+    freed->next = free_list;
+    free_list = freed;
+}
+
+} // namespace cata
@@ -0,0 +1,122 @@
+#pragma once
+#ifndef CATA_POOL_ALLOCATOR_H
+#define CATA_POOL_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace cata
+{
+
+/**
+ * Hands out blocks of one fixed size from slabs that are allocated in one go and only
+ * released with the pool itself. Freed blocks go on a free list and are reused last in,
+ * first out, so objects created and destroyed in bursts (like monsters in a horde) don't
+ * hit the general purpose allocator at all after the first few slabs. The pool therefore
+ * stays as big as it was at its peak.
+ * Allocating and deallocating are guarded by a spin lock, they only ever take a few
+ * instructions.
+ */
+class block_pool
+{
+    public:
+        explicit block_pool( size_t block_size, size_t blocks_per_slab = 64 );
+        block_pool( const block_pool & ) = delete;
+        block_pool &operator=( const block_pool & ) = delete;
+
+        void *allocate();
+        void deallocate( void *block );
+
+        size_t slab_count() const {
+            const lock_guard lock( locked );
+            return slabs.size();
+        }
+
+    private:
+        struct free_block {
+            free_block *next;
+        };
+
+        size_t block_size;
+        size_t blocks_per_slab;
+        free_block *free_list = nullptr;
+        std::vector<std::unique_ptr<char[]>> slabs;
+        mutable std::atomic_flag locked = ATOMIC_FLAG_INIT;
+
+        class lock_guard
+        {
+            public:
+                explicit lock_guard( std::atomic_flag &flag ) : flag( flag ) {
+                    while( flag.test_and_set( std::memory_order_acquire ) ) {
+                    }
+                }
+                ~lock_guard() {
+                    flag.clear( std::memory_order_release );
+                }
+            private:
+                std::atomic_flag &flag;
+        };
+};
+
+/**
+ * The pool shared by all objects of the given size. It is never destroyed: objects held
+ * by other statics (like the monsters of the global game) may be freed after every
+ * function-local static is gone.
+ */
+template<size_t Size>
+block_pool &pool_for_size()
+{
+    static block_pool &pool = *new block_pool( Size );
+    return pool;
+}
+
+/**
+ * Standard allocator on top of @ref block_pool, for single objects. Meant for
+ * `std::allocate_shared`, which puts the object and its reference counts into one block.
+ * Array allocations fall back to `operator new`.
+ */
+template<typename T>
+class pool_allocator
+{
+    public:
+        using value_type = T;
+
+        pool_allocator() = default;
+        template<typename U>
+        pool_allocator( const pool_allocator<U> & ) {}
+
+        T *allocate( size_t n ) {
+            static_assert( alignof( T ) <= alignof( std::max_align_t ),
+                           "block_pool only guarantees fundamental alignment" );
+            if( n != 1 ) {
+                return static_cast<T *>( ::operator new( n * sizeof( T ) ) );
+            }
+            return static_cast<T *>( pool_for_size<sizeof( T )>().allocate() );
+        }
+        void deallocate( T *p, size_t n ) {
+            if( n != 1 ) {
+                ::operator delete( p );
+                return;
+            }
+            pool_for_size<sizeof( T )>().deallocate( p );
+        }
+};
+
+template<typename T, typename U>
+bool operator==( const pool_allocator<T> &, const pool_allocator<U> & )
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=( const pool_allocator<T> &, const pool_allocator<U> & )
+{
+    return false;
+}
+
+} // namespace cata
+
+#endif // CATA_POOL_ALLOCATOR_H
@@ -1708,11 +1708,12 @@ void faction_manager::deserialize( JsonIn &jsin )
 void Creature_tracker::deserialize( JsonIn &jsin )
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_locations();
+    faction_members_.clear();
     jsin.start_array();
     while( !jsin.end_array() ) {
         // @todo would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
-        std::shared_ptr<monster> mptr = std::make_shared<monster>();
+        std::shared_ptr<monster> mptr = make_shared_monster();
         jsin.read( *mptr );
         add( mptr );
     }
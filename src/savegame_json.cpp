@@ -346,6 +346,7 @@ void SkillLevel::deserialize( JsonIn &jsin )
 {
     JsonObject data = jsin.get_object();
     data.read( "level", _level );
+    ++level_changes;
     data.read( "exercise", _exercise );
     data.read( "istraining", _isTraining );
     if( !data.read( "lastpracticed", _lastPracticed ) ) {
@@ -1630,6 +1631,8 @@ void npc::load( JsonObject &data )
     if( !data.read( "last_updated", last_updated ) ) {
         last_updated = calendar::turn;
     }
+    absent_since = calendar::before_time_starts;
+    data.read( "absent_since", absent_since );
     // TODO: time_point does not have a default constructor, need to read in the map manually
     {
         complaints.clear();
@@ -1709,6 +1712,7 @@ void npc::store( JsonOut &json ) const
     json.member( "restock", restock );
 
     json.member( "last_updated", last_updated );
+    json.member( "absent_since", absent_since );
     json.member( "complaints", complaints );
 }
 
@@ -2986,6 +2990,7 @@ void Creature::load( JsonObject &jsin )
                     ( *effects )[id][bp] = e;
                     on_effect_int_change( id, e.get_intensity(), bp );
                 }
+                effects->update_type( id );
             }
         }
     }
@@ -3697,6 +3702,7 @@ void submap::store( JsonOut &jsout ) const
 
 void submap::load( JsonIn &jsin, const std::string &member_name, bool rubpow_update )
 {
+    scent_flags_dirty = true;
     if( member_name == "turn_last_touched" ) {
         last_touched = jsin.get_int();
     } else if( member_name == "temperature" ) {
@@ -3856,10 +3862,10 @@ void submap::load( JsonIn &jsin, const std::string &member_name, bool rubpow_upd
                 } else {
                     ft = field_types::get_field_type_by_legacy_enum( type_int ).id;
                 }
-                if( fld[i][j].find_field( ft ) == nullptr ) {
+                if( fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) ) ) {
                     field_count++;
+                    field_tiles.set( field_tile( { i, j } ) );
                 }
-                fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) );
             }
         }
     } else if( member_name == "graffiti" ) {
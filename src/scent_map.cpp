@@ -5,6 +5,7 @@
 #include <algorithm>
 
 #include "calendar.h"
+#include "cata_utility.h"
 #include "color.h"
 #include "game.h"
 #include "map.h"
@@ -13,6 +14,9 @@
 
 static constexpr int SCENT_RADIUS = 40;
 
+template<typename T>
+using scent_grid = std::array<std::array<T, MAPSIZE_Y>, MAPSIZE_X>;
+
 static nc_color sev( const size_t level )
 {
     static const std::array<nc_color, 22> colors = { {
@@ -50,6 +54,11 @@ void scent_map::reset()
             val = 0;
         }
     }
+    for( auto &channel : extra_scent ) {
+        for( auto &elem : channel ) {
+            elem.fill( 0 );
+        }
+    }
 }
 
 void scent_map::decay()
@@ -59,6 +68,17 @@ void scent_map::decay()
             val = std::max( 0, val - 1 );
         }
     }
+    extra_scent_decay_due = !extra_scent_decay_due;
+    if( !extra_scent_decay_due ) {
+        return;
+    }
+    for( auto &channel : extra_scent ) {
+        for( auto &elem : channel ) {
+            for( auto &val : elem ) {
+                val = val > 0 ? val - 1 : 0;
+            }
+        }
+    }
 }
 
 void scent_map::draw( const catacurses::window &win, const int div, const tripoint &center ) const
@@ -74,16 +94,26 @@ void scent_map::draw( const catacurses::window &win, const int div, const tripoi
     }
 }
 
-void scent_map::shift( const int sm_shift_x, const int sm_shift_y )
+template<typename T>
+static void shift_scent( scent_grid<T> &scent, const point &shift )
 {
-    scent_array<int> new_scent;
+    const rectangle bounds( point_zero, point( MAPSIZE_X, MAPSIZE_Y ) );
+    scent_grid<T> new_scent;
     for( size_t x = 0; x < MAPSIZE_X; ++x ) {
         for( size_t y = 0; y < MAPSIZE_Y; ++y ) {
-            const point p( x + sm_shift_x, y + sm_shift_y );
-            new_scent[x][y] = inbounds( p ) ? grscent[ p.x ][ p.y ] : 0;
+            const point p( x + shift.x, y + shift.y );
+            new_scent[x][y] = bounds.contains_half_open( p ) ? scent[ p.x ][ p.y ] : 0;
         }
     }
-    grscent = new_scent;
+    scent = new_scent;
+}
+
+void scent_map::shift( const int sm_shift_x, const int sm_shift_y )
+{
+    shift_scent( grscent, point( sm_shift_x, sm_shift_y ) );
+    for( auto &channel : extra_scent ) {
+        shift_scent( channel, point( sm_shift_x, sm_shift_y ) );
+    }
 }
 
 int scent_map::get( const tripoint &p ) const
@@ -101,6 +131,29 @@ void scent_map::set( const tripoint &p, int value )
     }
 }
 
+int scent_map::get( const tripoint &p, const scent_type type ) const
+{
+    if( type == scent_type::avatar ) {
+        return get( p );
+    }
+    if( inbounds( p ) ) {
+        const int value = extra_scent[static_cast<size_t>( type ) - 1][p.x][p.y];
+        if( value > 0 ) {
+            return value * 2 - std::abs( gm.get_levz() - p.z );
+        }
+    }
+    return 0;
+}
+
+void scent_map::set( const tripoint &p, const int value, const scent_type type )
+{
+    if( type == scent_type::avatar ) {
+        set( p, value );
+    } else if( inbounds( p ) ) {
+        extra_scent[static_cast<size_t>( type ) - 1][p.x][p.y] = clamp( value / 2, 0, 255 );
+    }
+}
+
 void scent_map::set_unsafe( const tripoint &p, int value )
 {
     grscent[p.x][p.y] = value;
@@ -131,6 +184,104 @@ bool scent_map::inbounds( const tripoint &p ) const
     return scent_map_boundaries.contains_half_open( p.xy() );
 }
 
+namespace
+{
+
+// Per-square diffusion factors, shared by all scent channels
+struct scent_masks {
+    const scent_grid<int> &weight;
+    const scent_grid<int> &square_diffusivity;
+    const scent_grid<int> &keeps_scent;
+};
+
+} // namespace
+
+// Diffuses one scent channel over the window. The masks must cover the window plus a
+// one square border.
+template<typename T>
+static void diffuse_scent( scent_grid<T> &grscent,
+                           const scent_masks &masks, const rectangle &window )
+{
+    const int scentmap_minx = window.p_min.x;
+    const int scentmap_miny = window.p_min.y;
+    const int scentmap_maxx = window.p_max.x;
+    const int scentmap_maxy = window.p_max.y;
+
+    // These intermediate matrices need to be at least [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1]
+    // in size to hold enough data. All of them are laid out like grscent, so the inner loops
+    // below run over contiguous memory without branches and can be vectorized.
+    scent_grid<int> sum_3_scent_y;
+    scent_grid<int> squares_used_y;
+
+    // Columns whose scent is zero everywhere in the window don't spread anything.
+    std::array<bool, MAPSIZE_X> has_scent;
+    for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        const T *const scent = grscent[x].data();
+        bool any = false;
+        for( int y = scentmap_miny - 1; y <= scentmap_maxy + 1; ++y ) {
+            any = any || scent[y] != 0;
+        }
+        has_scent[x] = any;
+    }
+
+    // Sum neighbors in the y direction.  This way, each square gets called 3 times instead of 9
+    // times.
+    // note: this method needs an array that is one square larger on each side in the x direction
+    // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
+    // MAPSIZE_X, but if that changes, this may need tweaking.
+    for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        const int *const w = masks.weight[x].data();
+        const T *const scent = grscent[x].data();
+        int *const sum = sum_3_scent_y[x].data();
+        int *const used = squares_used_y[x].data();
+        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+            used[y] = w[y - 1] + w[y] + w[y + 1];
+        }
+        if( !has_scent[x] ) {
+            std::fill( sum + scentmap_miny, sum + scentmap_maxy + 1, 0 );
+            continue;
+        }
+        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+            // remember the sum of the scent val for the 3 neighboring squares that can defuse into
+            sum[y] = w[y - 1] * scent[y - 1] + w[y] * scent[y] + w[y + 1] * scent[y + 1];
+        }
+    }
+
+    // Rest of the scent map
+    for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
+        T *const scent = grscent[x].data();
+        if( !has_scent[x - 1] && !has_scent[x] && !has_scent[x + 1] ) {
+            // Nothing to spread, and nothing here that a wall could absorb
+            continue;
+        }
+        const int *const used_w = squares_used_y[x - 1].data();
+        const int *const used_c = squares_used_y[x].data();
+        const int *const used_e = squares_used_y[x + 1].data();
+        const int *const sum_w = sum_3_scent_y[x - 1].data();
+        const int *const sum_c = sum_3_scent_y[x].data();
+        const int *const sum_e = sum_3_scent_y[x + 1].data();
+        const int *const diff = masks.square_diffusivity[x].data();
+        const int *const keep = masks.keeps_scent[x].data();
+        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+            // to how many neighboring squares do we diffuse out? (include our own square
+            // since we also include our own square when diffusing in)
+            const int squares_used = used_w[y] + used_c[y] + used_e[y];
+            const int this_diffusivity = diff[y];
+            // take the old scent and subtract what diffuses out
+            const int old_scent = scent[y];
+            int temp_scent = old_scent * ( 10 * 1000 - squares_used * this_diffusivity );
+            // neighboring walls and reduce_scent squares absorb some scent
+            temp_scent -= old_scent * this_diffusivity * ( 90 - squares_used ) / 5;
+            // we've already summed neighboring scent values in the y direction in the previous
+            // loop. Now we do it for the x direction, multiply by diffusion, and this is what
+            // diffuses into our current square. Squares that block scent end up with none.
+            scent[y] = keep[y] * ( ( temp_scent
+                                     + this_diffusivity * ( sum_w[y] + sum_c[y] + sum_e[y] )
+                                   ) / ( 1000 * 10 ) );
+        }
+    }
+}
+
 void scent_map::update( const tripoint &center, map &m )
 {
     // Stop updating scent after X turns of the player not moving.
@@ -142,13 +293,13 @@ void scent_map::update( const tripoint &center, map &m )
         return;
     }
 
-    // note: the next four intermediate matrices need to be at least
-    // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1] in size to hold enough data
-    // The code I'm modifying used [MAPSIZE_X]. I'm staying with that to avoid new bugs.
-
-    // These two matrices are transposed so that x addresses are contiguous in memory
-    scent_array<int> sum_3_scent_y;
-    scent_array<int> squares_used_y;
+    // The masks below are shared by every scent channel and laid out like grscent.
+    // Weight of each square when diffusing into its neighbors: 0, 2 or 10
+    scent_array<int> weight;
+    // Diffusivity of each square, 0 for squares that block scent
+    scent_array<int> square_diffusivity;
+    // 0 for squares that block scent (and lose it all), 1 otherwise
+    scent_array<int> keeps_scent;
 
     // these are for caching flag lookups
     scent_array<bool> blocks_scent; // currently only TFLAG_WALL blocks scent
@@ -164,69 +315,27 @@ void scent_map::update( const tripoint &center, map &m )
     // stability. This is essentially a decimal number * 1000.
     const int diffusivity = 100;
 
-    // The new scent flag searching function. Should be wayyy faster than the old one.
+    // Terrain and furniture flags are cached per submap, so this is mostly copying.
     m.scent_blockers( blocks_scent, reduces_scent, point( scentmap_minx - 1, scentmap_miny - 1 ),
                       point( scentmap_maxx + 1, scentmap_maxy + 1 ) );
-    // Sum neighbors in the y direction.  This way, each square gets called 3 times instead of 9
-    // times. This cost us an extra loop here, but it also eliminated a loop at the end, so there
-    // is a net performance improvement over the old code. Could probably still be better.
-    // note: this method needs an array that is one square larger on each side in the x direction
-    // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
-    // MAPSIZE_X, but if that changes, this may need tweaking.
+
     for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
-        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = y - 1; i <= y + 1; ++i ) {
-                if( !blocks_scent[x][i] ) {
-                    if( reduces_scent[x][i] ) {
-                        // only 20% of scent can diffuse on REDUCE_SCENT squares
-                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
-                        squares_used_y[y][x] += 2;
-                    } else {
-                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
-                        squares_used_y[y][x] += 10;
-                    }
-                }
-            }
+        for( int y = scentmap_miny - 1; y <= scentmap_maxy + 1; ++y ) {
+            const bool reduces = reduces_scent[x][y];
+            const bool blocks = blocks_scent[x][y];
+            // only 20% of scent can diffuse on REDUCE_SCENT squares
+            weight[x][y] = blocks ? 0 : reduces ? 2 : 10;
+            //less air movement for REDUCE_SCENT square
+            square_diffusivity[x][y] = blocks ? 0 : reduces ? diffusivity / 5 : diffusivity;
+            keeps_scent[x][y] = blocks ? 0 : 1;
         }
     }
 
-    // Rest of the scent map
-    for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
-        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            auto &scent_here = grscent[x][y];
-            if( !blocks_scent[x][y] ) {
-                // to how many neighboring squares do we diffuse out? (include our own square
-                // since we also include our own square when diffusing in)
-                const int squares_used = squares_used_y[y][x - 1]
-                                         + squares_used_y[y][x]
-                                         + squares_used_y[y][x + 1];
-
-                int this_diffusivity;
-                if( !reduces_scent[x][y] ) {
-                    this_diffusivity = diffusivity;
-                } else {
-                    this_diffusivity = diffusivity / 5; //less air movement for REDUCE_SCENT square
-                }
-                // take the old scent and subtract what diffuses out
-                int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
-                // neighboring walls and reduce_scent squares absorb some scent
-                temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
-                // we've already summed neighboring scent values in the y direction in the previous
-                // loop. Now we do it for the x direction, multiply by diffusion, and this is what
-                // diffuses into our current square.
-                scent_here =
-                    ( temp_scent
-                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
-                                             + sum_3_scent_y[y][x]
-                                             + sum_3_scent_y[y][x + 1] )
-                    ) / ( 1000 * 10 );
-            } else {
-                // this cell blocks scent
-                scent_here = 0;
-            }
-        }
+    const scent_masks masks{ weight, square_diffusivity, keeps_scent };
+    const rectangle window( point( scentmap_minx, scentmap_miny ),
+                            point( scentmap_maxx, scentmap_maxy ) );
+    diffuse_scent( grscent, masks, window );
+    for( auto &channel : extra_scent ) {
+        diffuse_scent( channel, masks, window );
     }
 }
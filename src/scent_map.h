@@ -3,6 +3,7 @@
 #define SCENT_H
 
 #include <array>
+#include <cstdint>
 #include <string>
 
 #include "calendar.h"
@@ -13,6 +14,15 @@
 
 static constexpr int SCENT_MAP_Z_REACH = 1;
 
+/** Whose scent a scent map value refers to. */
+enum class scent_type : int {
+    /** The avatar, the only scent tracked before NPCs left scent too. */
+    avatar,
+    /** Any NPC. */
+    npc,
+    num_scent_types
+};
+
 class map;
 class game;
 
@@ -28,13 +38,23 @@ class scent_map
         using scent_array = std::array<std::array<T, MAPSIZE_Y>, MAPSIZE_X>;
 
         scent_array<int> grscent;
+        /**
+         * Scent of everything but the avatar, one byte per square and type, stored at half
+         * resolution (a stored 255 is a scent of 510). Only grscent is saved.
+         */
+        static constexpr size_t num_extra_types = static_cast<size_t>( scent_type::num_scent_types ) - 1;
+        std::array<scent_array<std::uint8_t>, num_extra_types> extra_scent;
+        /** One stored unit of @ref extra_scent is two real ones, so it decays every other turn. */
+        bool extra_scent_decay_due = false;
         cata::optional<tripoint> player_last_position;
         time_point player_last_moved = calendar::before_time_starts;
 
         const game &gm;
 
     public:
-        scent_map( const game &g ) : gm( g ) { }
+        scent_map( const game &g ) : gm( g ) {
+            reset();
+        }
 
         void deserialize( const std::string &data );
         std::string serialize() const;
@@ -54,6 +74,8 @@ class scent_map
         /**@{*/
         void set( const tripoint &p, int value );
         int get( const tripoint &p ) const;
+        void set( const tripoint &p, int value, scent_type type );
+        int get( const tripoint &p, scent_type type ) const;
         /**@}*/
         void set_unsafe( const tripoint &p, int value );
         int get_unsafe( const tripoint &p ) const;
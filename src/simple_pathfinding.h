@@ -2,7 +2,10 @@
 #ifndef SIMPLE_PATHFINDINDING_H
 #define SIMPLE_PATHFINDINDING_H
 
+#include <algorithm>
+#include <cstddef>
 #include <limits>
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -34,6 +37,117 @@ struct path {
     std::vector<node> nodes;
 };
 
+/**
+ * Scratch space reused by every find_path() call on a thread, so that searches over large
+ * areas don't allocate and clear per-tile arrays each time.
+ * Tiles are only valid when their generation matches the current search.
+ */
+struct search_buffers {
+    struct tile {
+        unsigned int generation = 0;
+        int priority = 0;
+        short dir = 0;
+        bool opened = false;
+        bool closed = false;
+    };
+
+    // Priorities up to this are kept in buckets, anything above in a regular heap
+    static constexpr int max_bucket = 4096;
+    // Larger tile arrays (a few overmaps' worth) are freed once their search is done
+    static constexpr size_t max_kept_tiles = 1 << 17;
+
+    std::vector<tile> tiles;
+    unsigned int generation = 0;
+    std::vector<std::vector<node>> buckets;
+    std::priority_queue<node, std::vector<node>> overflow;
+    size_t lowest = 0;
+    size_t highest = 0;
+    size_t bucketed = 0;
+    // Nodes expanded by the last search
+    size_t expanded = 0;
+    // Set while a search runs, a nested search gets buffers of its own
+    bool in_use = false;
+
+    void start( const size_t map_size ) {
+        if( tiles.size() < map_size ) {
+            tiles.resize( map_size );
+        }
+        if( ++generation == 0 ) {
+            for( tile &t : tiles ) {
+                t.generation = 0;
+            }
+            generation = 1;
+        }
+        for( size_t i = lowest; i <= highest && i < buckets.size(); i++ ) {
+            buckets[i].clear();
+        }
+        overflow = std::priority_queue<node, std::vector<node>>();
+        lowest = std::numeric_limits<size_t>::max();
+        highest = 0;
+        bucketed = 0;
+        expanded = 0;
+    }
+
+    void finish() {
+        in_use = false;
+        if( tiles.size() > max_kept_tiles ) {
+            tiles = std::vector<tile>();
+            generation = 0;
+        }
+    }
+
+    tile &at( const size_t index ) {
+        tile &t = tiles[index];
+        if( t.generation != generation ) {
+            t = tile();
+            t.generation = generation;
+        }
+        return t;
+    }
+
+    bool empty() const {
+        return bucketed == 0 && overflow.empty();
+    }
+
+    void push( const node &n ) {
+        if( n.priority > max_bucket ) {
+            overflow.push( n );
+            return;
+        }
+        const size_t b = n.priority;
+        if( b >= buckets.size() ) {
+            buckets.resize( b + 1 );
+        }
+        buckets[b].push_back( n );
+        lowest = std::min( lowest, b );
+        highest = std::max( highest, b );
+        bucketed++;
+    }
+
+    node pop() {
+        if( bucketed == 0 ) {
+            const node n = overflow.top();
+            overflow.pop();
+            return n;
+        }
+        while( buckets[lowest].empty() ) {
+            lowest++;
+        }
+        // Ties go to the newest node, which tends to be the one closest to the destination
+        // when the priority includes a distance estimate
+        const node n = buckets[lowest].back();
+        buckets[lowest].pop_back();
+        bucketed--;
+        return n;
+    }
+};
+
+inline search_buffers &get_search_buffers()
+{
+    static thread_local search_buffers buffers;
+    return buffers;
+}
+
 /**
  * @param source Starting point of path
  * @param dest End point of path
@@ -72,38 +186,49 @@ path find_path( const point &source,
 
     const node first_node( source, 5, 1000 );
 
-    if( estimator( first_node, nullptr ) == rejected ) {
+    if( estimator( first_node, nullptr ) < 0 ) {
         return res;
     }
 
-    const size_t map_size = max_x * max_y;
-
-    std::vector<bool> closed( map_size, false );
-    std::vector<int> open( map_size, 0 );
-    std::vector<short> dirs( map_size, 0 );
-    std::priority_queue<node, std::vector<node>> nodes[2];
+    search_buffers &shared = get_search_buffers();
+    std::unique_ptr<search_buffers> nested;
+    if( shared.in_use ) {
+        nested = std::make_unique<search_buffers>();
+    }
+    search_buffers &buf = nested ? *nested : shared;
+    buf.start( max_x * max_y );
+    buf.in_use = true;
+    struct finish_on_return {
+        search_buffers &buf;
+        ~finish_on_return() {
+            buf.finish();
+        }
+    } finisher{ buf };
 
-    int i = 0;
-    nodes[i].push( first_node );
-    open[map_index( source )] = std::numeric_limits<int>::max();
+    search_buffers::tile &first_tile = buf.at( map_index( source ) );
+    first_tile.opened = true;
+    first_tile.priority = first_node.priority;
+    buf.push( first_node );
 
     // use A* to find the shortest path from (x1,y1) to (x2,y2)
-    while( !nodes[i].empty() ) {
-        const node mn( nodes[i].top() ); // get the best-looking node
-
-        nodes[i].pop();
+    while( !buf.empty() ) {
+        const node mn( buf.pop() ); // get the best-looking node
+        search_buffers::tile &cur = buf.at( map_index( mn.pos ) );
+        // Nodes are never removed from the queue when a better way to them is found,
+        // skip the outdated entries instead
+        if( cur.closed || cur.priority != mn.priority ) {
+            continue;
+        }
         // mark it visited
-        closed[map_index( mn.pos )] = true;
+        cur.closed = true;
+        buf.expanded++;
 
         // if we've reached the end, draw the path and return
         if( mn.pos == dest ) {
             point p = mn.pos;
 
-            res.nodes.reserve( nodes[i].size() );
-
             while( p != source ) {
-                const int n = map_index( p );
-                const int dir = dirs[n];
+                const int dir = buf.at( map_index( p ) ).dir;
                 res.nodes.emplace_back( p, dir );
                 p += d[dir];
             }
@@ -115,42 +240,29 @@ path find_path( const point &source,
 
         for( int dir = 0; dir < 4; dir++ ) {
             const point p = mn.pos + d[dir];
-            const int n = map_index( p );
             // don't allow:
             // * out of bounds
             // * already traversed tiles
-            if( !inbounds( p ) || closed[n] ) {
+            if( !inbounds( p ) ) {
+                continue;
+            }
+            search_buffers::tile &next = buf.at( map_index( p ) );
+            if( next.closed ) {
                 continue;
             }
 
             node cn( p, dir );
             cn.priority = estimator( cn, &mn );
 
-            if( cn.priority == rejected ) {
+            if( cn.priority < 0 ) {
                 continue;
             }
             // record direction to shortest path
-            if( open[n] == 0 || open[n] > cn.priority ) {
-                dirs[n] = ( dir + 2 ) % 4;
-
-                if( open[n] != 0 ) {
-                    while( nodes[i].top().pos != p ) {
-                        nodes[1 - i].push( nodes[i].top() );
-                        nodes[i].pop();
-                    }
-                    nodes[i].pop();
-
-                    if( nodes[i].size() > nodes[1 - i].size() ) {
-                        i = 1 - i;
-                    }
-                    while( !nodes[i].empty() ) {
-                        nodes[1 - i].push( nodes[i].top() );
-                        nodes[i].pop();
-                    }
-                    i = 1 - i;
-                }
-                open[n] = cn.priority;
-                nodes[i].push( cn );
+            if( !next.opened || next.priority > cn.priority ) {
+                next.dir = ( dir + 2 ) % 4;
+                next.opened = true;
+                next.priority = cn.priority;
+                buf.push( cn );
             }
         }
     }
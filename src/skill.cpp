@@ -21,6 +21,8 @@ std::map<skill_id, Skill> Skill::contextual_skills;
 
 std::vector<SkillDisplayType> SkillDisplayType::skillTypes;
 
+int SkillLevel::level_changes = 0;
+
 static const Skill invalid_skill;
 static const SkillDisplayType invalid_skill_type;
 
@@ -194,6 +196,7 @@ void SkillLevel::train( int amount, bool skip_scaling )
     if( _exercise >= 100 * ( _level + 1 ) * ( _level + 1 ) ) {
         _exercise = 0;
         ++_level;
+        ++level_changes;
         if( _level > _highestLevel ) {
             _highestLevel = _level;
         }
@@ -238,6 +241,7 @@ bool SkillLevel::rust( bool charged_bio_mem )
         if( rust_type == "vanilla" || rust_type == "int" ) {
             _exercise = ( 100 * _level * _level ) - 1;
             --_level;
+            ++level_changes;
         } else {
             _exercise = 0;
         }
@@ -86,6 +86,9 @@ class SkillLevel
     public:
         SkillLevel() = default;
 
+        /** Goes up whenever the level of any skill of anyone changes. */
+        static int level_changes;
+
         bool isTraining() const {
             return _isTraining;
         }
@@ -99,6 +102,7 @@ class SkillLevel
         }
         int level( int plevel ) {
             _level = plevel;
+            ++level_changes;
             if( _level > _highestLevel ) {
                 _highestLevel = _level;
             }
@@ -12,18 +12,21 @@
 
 #include "avatar.h"
 #include "coordinate_conversions.h"
+#include "creature_tracker.h"
 #include "debug.h"
 #include "effect.h"
 #include "enums.h"
 #include "game.h"
 #include "item.h"
 #include "itype.h"
+#include "lightmap.h"
 #include "line.h"
 #include "map.h"
 #include "map_iterator.h"
 #include "messages.h"
 #include "monster.h"
 #include "npc.h"
+#include "options.h"
 #include "overmapbuffer.h"
 #include "player.h"
 #include "string_formatter.h"
@@ -263,10 +266,41 @@ static int get_signal_for_hordes( const centroid &centr )
     return 0;
 }
 
+// Volume lost to every wall or other opaque tile between a sound and a listener,
+// and to every floor, when SOUND_ATTENUATION is enabled.
+static constexpr int wall_attenuation = 10;
+static constexpr int floor_attenuation = 20;
+
+int sounds::attenuated_volume( const tripoint &source, const tripoint &listener, const int vol )
+{
+    int attenuation = 0;
+    if( g->m.inbounds( source ) ) {
+        const level_cache &cache = g->m.get_cache_ref( source.z );
+        bresenham( source.xy(), listener.xy(), 0, [&]( const point & p ) {
+            if( p == listener.xy() ) {
+                return false;
+            }
+            if( cache.transparency_cache[p.x][p.y] <= LIGHT_TRANSPARENCY_SOLID ) {
+                attenuation += wall_attenuation;
+            }
+            return attenuation < vol;
+        } );
+    }
+    const int top = std::max( source.z, listener.z );
+    for( int z = std::min( source.z, listener.z ) + 1; z <= top && attenuation < vol; z++ ) {
+        if( g->m.inbounds( tripoint( listener.xy(), z ) ) &&
+            g->m.get_cache_ref( z ).floor_cache[listener.x][listener.y] ) {
+            attenuation += floor_attenuation;
+        }
+    }
+    return std::max( vol - attenuation, 0 );
+}
+
 void sounds::process_sounds()
 {
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = weather::sound_attn( g->weather.weather );
+    const bool attenuate = get_option<bool>( "SOUND_ATTENUATION" );
     for( const auto &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -283,13 +317,18 @@ void sounds::process_sounds()
             const tripoint target( abs_sm, source.z );
             overmap_buffer.signal_hordes( target, sig_power );
         }
+        if( vol <= 0 ) {
+            continue;
+        }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // Monsters further than vol * 2 certainly won't hear it, so only look that far.
+        const int reach = vol * 2 - 1;
+        for( monster *critter : g->critter_tracker->monsters_in_radius( source, reach, reach ) ) {
             // TODO: Generalize this to Creature::hear_sound
-            const int dist = rl_dist( source, critter.pos() );
-            if( vol * 2 > dist ) {
-                // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist );
+            const int dist = rl_dist( source, critter->pos() );
+            const int heard_vol = attenuate ? attenuated_volume( source, critter->pos(), vol ) : vol;
+            if( heard_vol * 2 > dist ) {
+                critter->hear_sound( source, heard_vol, dist );
             }
         }
     }
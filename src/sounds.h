@@ -68,6 +68,9 @@ void reset_markers();
 // Methods for processing sound events, these
 // process_sounds() applies the sounds since the last turn to monster AI,
 void process_sounds();
+// Volume of a sound of volume vol from source, as heard at listener through the walls
+// and floors in between, used by process_sounds() when SOUND_ATTENUATION is on.
+int attenuated_volume( const tripoint &source, const tripoint &listener, int vol );
 // process_sound_markers applies sound events to the player and records them for display.
 void process_sound_markers( player *p );
 
@@ -2,8 +2,10 @@
 #ifndef STRING_ID_H
 #define STRING_ID_H
 
+#include <atomic>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 template<typename T>
 class int_id;
@@ -63,6 +65,20 @@ class string_id
          * to be special. Every string (including the empty one) may be a valid id.
          */
         string_id() : _cid( -1 ) {}
+        // The cached int id is atomic, which takes spelling the copy and move operations out
+        string_id( const This &other ) : _id( other._id ), _cid( other.cached_cid() ) {}
+        string_id( This &&other ) noexcept : _id( std::move( other._id ) ),
+            _cid( other.cached_cid() ) {}
+        This &operator=( const This &other ) {
+            _id = other._id;
+            _cid.store( other.cached_cid(), std::memory_order_relaxed );
+            return *this;
+        }
+        This &operator=( This &&other ) noexcept {
+            _id = std::move( other._id );
+            _cid.store( other.cached_cid(), std::memory_order_relaxed );
+            return *this;
+        }
         /**
          * Comparison, only useful when the id is used in std::map or std::set as key. Compares
          * the string id as with the strings comparison.
@@ -180,21 +196,26 @@ class string_id
         // TODO: Exposed for now. Hide these and make them accessible to the generic_factory only
 
         /**
-         * Assigns a new value for the cached int id.
+         * Assigns a new value for the cached int id. Ids are shared by all threads (most
+         * are statics), so the cache is atomic. Every thread caches the same value anyway.
          */
         void set_cid( const int_id<T> &cid ) const {
-            _cid = cid.to_i();
+            _cid.store( cid.to_i(), std::memory_order_relaxed );
         }
         /**
          * Returns the current value of cached id
          */
         int_id<T> get_cid() const {
-            return int_id<T>( _cid );
+            return int_id<T>( cached_cid() );
         }
 
     private:
+        int cached_cid() const {
+            return _cid.load( std::memory_order_relaxed );
+        }
+
         std::string _id;
-        mutable int _cid;
+        mutable std::atomic<int> _cid;
 };
 
 // Support hashing of string based ids by forwarding the hash of the string.
@@ -220,9 +220,40 @@ bool submap::contains_vehicle( vehicle *veh )
     return match != vehicles.end();
 }
 
+void submap::build_scent_flags() const
+{
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            const ter_t &t = ter[x][y].obj();
+            if( t.has_flag( TFLAG_WALL ) ) {
+                scent_flags[x][y] = scent_flag::blocks;
+            } else if( t.has_flag( TFLAG_REDUCE_SCENT ) ||
+                       frn[x][y].obj().has_flag( TFLAG_REDUCE_SCENT ) ) {
+                scent_flags[x][y] = scent_flag::reduces;
+            } else {
+                scent_flags[x][y] = scent_flag::normal;
+            }
+        }
+    }
+    scent_flags_dirty = false;
+}
+
+void submap::rebuild_field_tiles()
+{
+    field_tiles.reset();
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            if( fld[x][y].field_count() > 0 ) {
+                field_tiles.set( field_tile( { x, y } ) );
+            }
+        }
+    }
+}
+
 void submap::rotate( int turns )
 {
     turns = turns % 4;
+    scent_flags_dirty = true;
 
     if( turns == 0 ) {
         return;
@@ -264,6 +295,7 @@ void submap::rotate( int turns )
     }
 
     active_items.rotate_locations( turns, { SEEX, SEEY } );
+    rebuild_field_tiles();
 
     for( auto &elem : cosmetics ) {
         elem.pos = rotate_point( elem.pos );
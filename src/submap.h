@@ -2,6 +2,7 @@
 #ifndef SUBMAP_H
 #define SUBMAP_H
 
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -79,6 +80,7 @@ class submap : public maptile_soa<SEEX, SEEY>    // TODO: Use private inheritanc
 
         void set_furn( const point &p, furn_id furn ) {
             is_uniform = false;
+            scent_flags_dirty = true;
             frn[p.x][p.y] = furn;
         }
 
@@ -88,9 +90,32 @@ class submap : public maptile_soa<SEEX, SEEY>    // TODO: Use private inheritanc
 
         void set_ter( const point &p, ter_id terr ) {
             is_uniform = false;
+            scent_flags_dirty = true;
             ter[p.x][p.y] = terr;
         }
 
+        enum class scent_flag : std::uint8_t {
+            normal,
+            reduces,
+            blocks,
+        };
+
+        /**
+         * How the terrain and furniture on this square affect scent diffusion (vehicles
+         * are not included). Cached for the whole submap until terrain or furniture change.
+         */
+        scent_flag get_scent_flag( const point &p ) const {
+            if( scent_flags_dirty ) {
+                build_scent_flags();
+            }
+            return scent_flags[p.x][p.y];
+        }
+
+        /** Must be called after writing to @ref ter or @ref frn directly. */
+        void set_scent_flags_dirty() {
+            scent_flags_dirty = true;
+        }
+
         int get_radiation( const point &p ) const {
             return rad[p.x][p.y];
         }
@@ -192,6 +217,16 @@ class submap : public maptile_soa<SEEX, SEEY>    // TODO: Use private inheritanc
         active_item_cache active_items;
 
         int field_count = 0;
+        /**
+         * Tiles that may hold fields, see @ref field_tile. Set wherever field_count goes up and
+         * cleared once a tile is found empty, so field processing only looks at these.
+         */
+        std::bitset<SEEX * SEEY> field_tiles;
+        // Tiles are in the same order as the x, then y loops over the submap.
+        static size_t field_tile( const point &p ) {
+            return p.x * SEEY + p.y;
+        }
+        void rebuild_field_tiles();
         time_point last_touched = calendar::turn_zero;
         std::vector<spawn_point> spawns;
         /**
@@ -208,7 +243,11 @@ class submap : public maptile_soa<SEEX, SEEY>    // TODO: Use private inheritanc
         std::unique_ptr<computer> legacy_computer;
         int temperature = 0;
 
+        mutable scent_flag scent_flags[SEEX][SEEY];
+        mutable bool scent_flags_dirty = true;
+
         void update_legacy_computer();
+        void build_scent_flags() const;
 };
 
 /**
@@ -268,6 +307,7 @@ struct maptile {
             const bool ret = sm->fld[x][y].add_field( field_to_add, new_intensity, new_age );
             if( ret ) {
                 sm->field_count++;
+                sm->field_tiles.set( submap::field_tile( pos() ) );
             }
 
             return ret;
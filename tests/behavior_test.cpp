@@ -130,6 +130,36 @@ TEST_CASE( "behavior_tree", "[behavior]" )
     CHECK( maslows.tick( nullptr ) == "idle" );
 }
 
+TEST_CASE( "behavior_tree_evaluates_only_what_it_needs", "[behavior]" )
+{
+    int checks = 0;
+    behavior::status_t first_state = behavior::failure;
+    behavior::node_t first;
+    first.set_goal( "first" );
+    first.set_predicate( [&]( const behavior::oracle_t * ) {
+        checks++;
+        return first_state;
+    } );
+    behavior::status_t second_state = behavior::running;
+    behavior::node_t second = make_test_node( "second", &second_state );
+    behavior::node_t root;
+    root.set_strategy( &behavior::default_fallback );
+    root.add_child( &first );
+    root.add_child( &second );
+
+    behavior::tree choices;
+    choices.add( &root );
+    CHECK( choices.tick( nullptr ) == "second" );
+    CHECK( checks == 1 );
+    first_state = behavior::running;
+    // Later children aren't visited once one is running.
+    second_state = behavior::failure;
+    CHECK( choices.tick( nullptr ) == "first" );
+    CHECK( checks == 2 );
+    CHECK( choices.goal() == "first" );
+    CHECK( checks == 2 );
+}
+
 // Make assertions about loaded behaviors.
 TEST_CASE( "check_npc_behavior_tree", "[behavior]" )
 {
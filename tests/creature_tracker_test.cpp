@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "creature_tracker.h"
+#include "game.h"
+#include "map_helpers.h"
+#include "monfaction.h"
+#include "monster.h"
+#include "point.h"
+#include "pool_allocator.h"
+#include "type_id.h"
+
+TEST_CASE( "critter_at_follows_monster_moves", "[monster][creature_tracker]" )
+{
+    clear_map();
+    const tripoint start( 40, 40, 0 );
+    const tripoint moved = start + point( 3, 0 );
+    monster &zed = spawn_test_monster( "mon_zombie", start );
+    REQUIRE( g->critter_at<monster>( start ) == &zed );
+
+    zed.setpos( moved );
+    CHECK( g->critter_at<monster>( start ) == nullptr );
+    CHECK( g->critter_at<monster>( moved ) == &zed );
+
+    monster &other = spawn_test_monster( "mon_zombie", start );
+    REQUIRE( g->swap_critters( zed, other ) );
+    CHECK( g->critter_at<monster>( start ) == &zed );
+    CHECK( g->critter_at<monster>( moved ) == &other );
+
+    g->remove_zombie( zed );
+    CHECK( g->critter_at<monster>( start ) == nullptr );
+    CHECK( g->critter_at<monster>( moved ) == &other );
+
+    g->clear_zombies();
+    CHECK( g->critter_at<monster>( moved ) == nullptr );
+}
+
+TEST_CASE( "critter_at_ignores_dead_monsters", "[monster][creature_tracker]" )
+{
+    clear_map();
+    const tripoint pos( 40, 40, 0 );
+    monster &zed = spawn_test_monster( "mon_zombie", pos );
+    REQUIRE( g->critter_at<Creature>( pos ) == &zed );
+    zed.set_hp( 0 );
+    CHECK( g->critter_at<Creature>( pos ) == nullptr );
+}
+
+TEST_CASE( "monsters_in_radius_only_returns_nearby_monsters", "[monster][creature_tracker]" )
+{
+    clear_map();
+    const tripoint center( 60, 60, 0 );
+    monster &near = spawn_test_monster( "mon_zombie", center + point( 2, -3 ) );
+    monster &edge = spawn_test_monster( "mon_zombie", center + point( -5, 5 ) );
+    monster &far = spawn_test_monster( "mon_zombie", center + point( 6, 0 ) );
+    // Crosses into the next SEEX * SEEY bucket
+    monster &other_bucket = spawn_test_monster( "mon_zombie", center + point( 0, 30 ) );
+
+    const auto contains = []( const std::vector<monster *> &mons, const monster & m ) {
+        return std::find( mons.begin(), mons.end(), &m ) != mons.end();
+    };
+    std::vector<monster *> found = g->critter_tracker->monsters_in_radius( center, 5 );
+    CHECK( found.size() == 2 );
+    CHECK( contains( found, near ) );
+    CHECK( contains( found, edge ) );
+
+    far.setpos( center + point( 4, 4 ) );
+    found = g->critter_tracker->monsters_in_radius( center, 5 );
+    CHECK( found.size() == 3 );
+    CHECK( contains( found, far ) );
+    CHECK_FALSE( contains( found, other_bucket ) );
+
+    g->remove_zombie( near );
+    found = g->critter_tracker->monsters_in_rect( center - tripoint( 5, 5, 0 ),
+            center + tripoint( 5, 30, 0 ) );
+    CHECK( found.size() == 3 );
+    CHECK_FALSE( contains( found, near ) );
+    CHECK( contains( found, other_bucket ) );
+}
+
+TEST_CASE( "pooled_monsters_keep_weak_semantics", "[monster][creature_tracker]" )
+{
+    std::shared_ptr<monster> first = make_shared_monster( mtype_id( "mon_zombie" ) );
+    std::weak_ptr<monster> weak = first;
+    const monster *const first_address = first.get();
+    REQUIRE_FALSE( weak.expired() );
+
+    first.reset();
+    CHECK( weak.expired() );
+    // The block also holds the reference counts, so it's only freed with the last weak_ptr
+    const std::shared_ptr<monster> second = make_shared_monster( mtype_id( "mon_zombie" ) );
+    CHECK( second.get() != first_address );
+    CHECK( weak.expired() );
+    weak.reset();
+    // The freed block is the next one handed out
+    const std::shared_ptr<monster> third = make_shared_monster( mtype_id( "mon_zombie" ) );
+    CHECK( third.get() == first_address );
+
+    cata::block_pool pool( 3, 4 );
+    std::vector<void *> blocks;
+    for( int i = 0; i < 5; ++i ) {
+        blocks.push_back( pool.allocate() );
+    }
+    CHECK( pool.slab_count() == 2 );
+    pool.deallocate( blocks[1] );
+    CHECK( pool.allocate() == blocks[1] );
+    CHECK( pool.slab_count() == 2 );
+}
+
+TEST_CASE( "faction_members_follow_the_tracker", "[monster][creature_tracker]" )
+{
+    clear_map();
+    const mfaction_id zombie_faction = mfaction_str_id( "zombie" ).id();
+    const mfaction_id player_faction = mfaction_str_id( "player" ).id();
+    const auto members = [&]( const mfaction_id & faction ) {
+        return g->critter_tracker->faction_members( faction ).size();
+    };
+    REQUIRE( members( zombie_faction ) == 0 );
+
+    monster &zed = spawn_test_monster( "mon_zombie", { 40, 40, 0 } );
+    spawn_test_monster( "mon_zombie", { 42, 40, 0 } );
+    monster &pet = spawn_test_monster( "mon_zombie", { 44, 40, 0 } );
+    pet.friendly = -1;
+    g->critter_tracker->rebuild_cache();
+    CHECK( members( zombie_faction ) == 2 );
+    CHECK( members( player_faction ) == 1 );
+
+    g->remove_zombie( zed );
+    CHECK( members( zombie_faction ) == 1 );
+    pet.set_hp( 0 );
+    g->critter_tracker->remove_dead();
+    CHECK( members( player_faction ) == 0 );
+}
+
+TEST_CASE( "cached_faction_attitudes_match_the_faction_tree", "[monster][monfaction]" )
+{
+    const std::vector<std::string> names = { "player", "zombie", "bot", "animal", "small_animal",
+                                             "insect", "bee", "spider", "cop_zombie"
+                                           };
+    for( const std::string &from : names ) {
+        for( const std::string &to : names ) {
+            const monfaction &faction = mfaction_str_id( from ).obj();
+            const mfaction_id other = mfaction_str_id( to ).id();
+            INFO( from << " -> " << to );
+            CHECK( faction.attitude( other ) == faction.resolve_attitude( other ) );
+        }
+    }
+    CHECK( mfaction_str_id( "zombie" ).obj().attitude( mfaction_str_id( "zombie" ).id() ) ==
+           MFA_FRIENDLY );
+}
@@ -0,0 +1,78 @@
+#include "catch/catch.hpp"
+#include "calendar.h"
+#include "field.h"
+#include "field_type.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "point.h"
+
+static time_duration blood_age( const tripoint &p )
+{
+    const field_entry *blood = g->m.get_field( p, fd_blood );
+    REQUIRE( blood != nullptr );
+    return blood->get_field_age();
+}
+
+TEST_CASE( "fields_are_processed_wherever_they_are_added", "[field]" )
+{
+    clear_map();
+    // Both on the same submap
+    const tripoint first( 37, 37, 0 );
+    const tripoint second( 40, 45, 0 );
+    REQUIRE( g->m.add_field( first, fd_blood, 1 ) );
+    REQUIRE( g->m.add_field( second, fd_blood, 1 ) );
+    g->m.process_fields();
+    CHECK( blood_age( first ) == 1_turns );
+    CHECK( blood_age( second ) == 1_turns );
+
+    g->m.remove_field( first, fd_blood );
+    CHECK( g->m.get_field( first, fd_blood ) == nullptr );
+    g->m.process_fields();
+    CHECK( blood_age( second ) == 2_turns );
+
+    // The emptied tile is picked up again once it has a field
+    REQUIRE( g->m.add_field( first, fd_blood, 1 ) );
+    g->m.process_fields();
+    CHECK( blood_age( first ) == 1_turns );
+    CHECK( blood_age( second ) == 3_turns );
+}
+
+TEST_CASE( "field_entries_stay_put_while_fields_come_and_go", "[field]" )
+{
+    field fld;
+    REQUIRE( fld.add_field( fd_blood, 1 ) );
+    field_entry *blood = fld.find_field( fd_blood );
+    REQUIRE( blood != nullptr );
+    REQUIRE( fld.add_field( fd_smoke, 2 ) );
+    REQUIRE( fld.add_field( fd_fire, 1 ) );
+    REQUIRE( fld.add_field( fd_bile, 1 ) );
+    CHECK_FALSE( fld.add_field( fd_smoke, 1 ) );
+    CHECK( fld.find_field( fd_smoke )->get_field_intensity() == 3 );
+    CHECK( fld.find_field( fd_blood ) == blood );
+    CHECK( fld.field_count() == 4 );
+
+    CHECK( fld.remove_field( fd_smoke ) );
+    CHECK_FALSE( fld.remove_field( fd_smoke ) );
+    CHECK( fld.find_field( fd_smoke ) == nullptr );
+    CHECK( fld.find_field( fd_blood ) == blood );
+    CHECK( fld.field_count() == 3 );
+    int seen = 0;
+    for( const auto &e : fld ) {
+        CHECK( e.first == e.second.get_field_type() );
+        seen++;
+    }
+    CHECK( seen == 3 );
+
+    const field copy = fld;
+    CHECK( copy.field_count() == 3 );
+    CHECK( copy.find_field( fd_bile ) != nullptr );
+    CHECK( copy.find_field( fd_bile ) != fld.find_field( fd_bile ) );
+
+    for( auto it = fld.begin(); it != fld.end(); ) {
+        fld.remove_field( it++ );
+    }
+    CHECK( fld.field_count() == 0 );
+    CHECK( fld.begin() == fld.end() );
+    CHECK( fld.displayed_field_type() == fd_null );
+}
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "avatar.h"
+#include "calendar.h"
 #include "catch/catch.hpp"
 #include "game.h"
 #include "map.h"
@@ -334,3 +335,72 @@ TEST_CASE( "monster_speed_trig", "[speed]" )
     trigdist = true;
     monster_check();
 }
+
+TEST_CASE( "only_idle_distant_monsters_use_reduced_ai", "[monster]" )
+{
+    clear_map();
+    g->u.setpos( { 20, 20, 0 } );
+    monster &near = spawn_test_monster( "mon_zombie", { 30, 20, 0 } );
+    monster &far = spawn_test_monster( "mon_zombie", { 100, 100, 0 } );
+    CHECK_FALSE( near.can_use_reduced_ai() );
+    CHECK( far.can_use_reduced_ai() );
+
+    WHEN( "the distant monster has somewhere to go" ) {
+        far.set_dest( { 90, 100, 0 } );
+        THEN( "it gets full AI" ) {
+            CHECK_FALSE( far.can_use_reduced_ai() );
+        }
+    }
+    WHEN( "the distant monster hears a noise" ) {
+        far.wander_to( { 90, 100, 0 }, 10 );
+        THEN( "it gets full AI" ) {
+            CHECK_FALSE( far.can_use_reduced_ai() );
+        }
+    }
+    WHEN( "the avatar comes close" ) {
+        g->u.setpos( { 95, 95, 0 } );
+        THEN( "it gets full AI" ) {
+            CHECK_FALSE( far.can_use_reduced_ai() );
+        }
+    }
+    WHEN( "a monster it doesn't care about comes close" ) {
+        spawn_test_monster( "mon_squirrel", { 95, 100, 0 } );
+        THEN( "it keeps reduced AI" ) {
+            CHECK( far.can_use_reduced_ai() );
+        }
+    }
+    WHEN( "a monster it hates comes within sight" ) {
+        spawn_test_monster( "mon_dog", { 100 - far.sight_range( default_daylight_level() ), 100, 0 } );
+        THEN( "it gets full AI" ) {
+            CHECK_FALSE( far.can_use_reduced_ai() );
+        }
+    }
+}
+
+TEST_CASE( "monster_effects_count_down_and_expire", "[monster][effect]" )
+{
+    clear_map();
+    monster &zed = spawn_test_monster( "mon_zombie", { 40, 40, 0 } );
+    const efftype_id effect_downed( "downed" );
+    const efftype_id effect_stunned( "stunned" );
+    REQUIRE_FALSE( zed.has_effect( effect_downed ) );
+
+    zed.add_effect( effect_downed, 2_turns );
+    zed.add_effect( effect_stunned, 5_turns );
+    CHECK( zed.has_effect( effect_downed ) );
+    CHECK( zed.has_effect( effect_downed, num_bp ) );
+    CHECK_FALSE( zed.has_effect( effect_downed, bp_arm_l ) );
+    CHECK_FALSE( zed.has_effect( efftype_id( "not_an_effect" ) ) );
+
+    for( int turn = 0; turn < 4; ++turn ) {
+        zed.process_effects();
+    }
+    CHECK_FALSE( zed.has_effect( effect_downed ) );
+    CHECK( zed.has_effect( effect_stunned ) );
+
+    zed.remove_effect( effect_stunned );
+    CHECK_FALSE( zed.has_effect( effect_stunned ) );
+    zed.add_effect( effect_stunned, 5_turns );
+    zed.clear_effects();
+    CHECK_FALSE( zed.has_effect( effect_stunned ) );
+}
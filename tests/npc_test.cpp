@@ -9,6 +9,7 @@
 #include "avatar.h"
 #include "catch/catch.hpp"
 #include "common_types.h"
+#include "creature_tracker.h"
 #include "faction.h"
 #include "field.h"
 #include "game.h"
@@ -16,6 +17,7 @@
 #include "map_helpers.h"
 #include "npc.h"
 #include "npc_class.h"
+#include "overmap.h"
 #include "overmapbuffer.h"
 #include "text_snippets.h"
 #include "veh_type.h"
@@ -28,6 +30,7 @@
 #include "string_id.h"
 #include "type_id.h"
 #include "point.h"
+#include "rng.h"
 
 class Creature;
 
@@ -452,3 +455,214 @@ TEST_CASE( "npc_can_target_player" )
     REQUIRE( hostile->current_target() != nullptr );
     CHECK( hostile->current_target() == static_cast<Creature *>( &g->u ) );
 }
+
+TEST_CASE( "find_npc_follows_npcs_between_overmaps", "[npc][overmapbuffer]" )
+{
+    clear_npcs();
+    std::shared_ptr<npc> guy = std::make_shared<npc>();
+    guy->normalize();
+    guy->randomize();
+    guy->spawn_at_sm( 5, 5, 0 );
+    const character_id id = guy->getID();
+    REQUIRE( overmap_buffer.find_npc( id ) == nullptr );
+
+    overmap_buffer.insert_npc( guy );
+    CHECK( overmap_buffer.find_npc( id ) == guy );
+
+    // Into the next overmap over
+    guy->travel_overmap( tripoint( OMAPX * 2 + 5, 5, 0 ) );
+    CHECK( overmap_buffer.find_npc( id ) == guy );
+    CHECK( overmap_buffer.get( point( 1, 0 ) ).find_npc( id ) == guy );
+
+    CHECK( overmap_buffer.remove_npc( id ) == guy );
+    CHECK( overmap_buffer.find_npc( id ) == nullptr );
+    CHECK( overmap_buffer.find_npc( character_id( -5 ) ) == nullptr );
+}
+
+TEST_CASE( "memoized_weapon_values_follow_item_and_skills", "[npc]" )
+{
+    standard_npc guy( "appraiser" );
+    item machete( "machete" );
+    const double fresh = guy.weapon_value( machete );
+    CHECK( guy.weapon_value( machete ) == fresh );
+
+    item worn_machete( "machete" );
+    worn_machete.set_damage( worn_machete.max_damage() );
+    CHECK( guy.weapon_value( worn_machete ) < fresh );
+    CHECK( guy.weapon_value( machete ) == fresh );
+
+    guy.set_skill_level( skill_id( "melee" ), 8 );
+    guy.set_skill_level( skill_id( "cutting" ), 8 );
+    CHECK( guy.weapon_value( machete ) > fresh );
+}
+
+TEST_CASE( "gathered_danger_candidates_match_a_fresh_assessment", "[npc]" )
+{
+    calendar::turn = calendar::turn_zero + 12_hours;
+    clear_map();
+    g->place_player( tripoint( 10, 10, 0 ) );
+    const character_id model_id = g->m.place_npc( point( 10, 10 ), string_id<npc_template>( "thug" ),
+                                  true );
+    g->load_npcs();
+    npc *guy = g->find_npc( model_id );
+    REQUIRE( guy != nullptr );
+    guy->setpos( tripoint( 15, 15, 0 ) );
+
+    monster &zed = spawn_test_monster( "mon_zombie", tripoint( 18, 15, 0 ) );
+    monster &pet = spawn_test_monster( "mon_dog", tripoint( 14, 15, 0 ) );
+    pet.friendly = -1;
+    const std::vector<npc_danger_candidates> gathered = gather_danger_candidates( { guy }, {
+        g->shared_from( zed ), g->shared_from( pet )
+    } );
+    REQUIRE( gathered.size() == 1 );
+    REQUIRE( gathered[0].threats.size() == 1 );
+    CHECK( gathered[0].threats[0].lock().get() == &zed );
+    REQUIRE( gathered[0].friends.size() == 1 );
+    CHECK( gathered[0].friends[0].lock().get() == &pet );
+
+    guy->regen_ai_cache();
+    Creature *const fresh_target = guy->current_target();
+    CHECK( fresh_target == static_cast<Creature *>( &zed ) );
+    npc_danger_candidates candidates = gathered[0];
+    guy->set_danger_candidates( std::move( candidates ) );
+    guy->regen_ai_cache();
+    CHECK( guy->current_target() == fresh_target );
+
+    // Candidates that are gone by the time the NPC moves are skipped
+    candidates = gathered[0];
+    g->remove_zombie( zed );
+    g->critter_tracker->remove_dead();
+    REQUIRE( candidates.threats[0].expired() );
+    guy->set_danger_candidates( std::move( candidates ) );
+    guy->regen_ai_cache();
+    CHECK( guy->current_target() == nullptr );
+}
+
+TEST_CASE( "offscreen_updates_leave_the_rest_to_on_load", "[npc]" )
+{
+    clear_map();
+    calendar::turn = calendar::turn_zero;
+    // Two identical NPCs, that also roll the same while they are updated
+    rng_set_engine_seed( 7 );
+    npc offscreen = create_model();
+    rng_set_engine_seed( 7 );
+    npc loaded = create_model();
+    // Not on any overmap, but on_load looks at the map around them
+    for( npc *guy : {
+             &offscreen, &loaded
+         } ) {
+        guy->set_fake( true );
+        guy->setpos( tripoint( 30, 30, 0 ) );
+    }
+    offscreen.last_updated = calendar::turn;
+    loaded.last_updated = calendar::turn;
+
+    calendar::turn = calendar::turn_zero + 6_hours + 10_minutes;
+    rng_set_engine_seed( 11 );
+    offscreen.update_offscreen();
+    CHECK( offscreen.last_updated > calendar::turn_zero + 5_hours );
+    CHECK( calendar::turn - offscreen.last_updated <= 30_minutes );
+    CHECK( offscreen.get_fatigue() > 0 );
+    const time_point after_first_update = offscreen.last_updated;
+    offscreen.update_offscreen();
+    CHECK( offscreen.last_updated == after_first_update );
+
+    // Both end up with the same steps, whether or not some were taken offscreen
+    offscreen.on_load();
+    rng_set_engine_seed( 11 );
+    loaded.on_load();
+    CHECK( offscreen.last_updated == calendar::turn );
+    CHECK( offscreen.get_hunger() == loaded.get_hunger() );
+    CHECK( offscreen.get_thirst() == loaded.get_thirst() );
+    CHECK( offscreen.get_fatigue() == loaded.get_fatigue() );
+}
+
+TEST_CASE( "long_absences_are_simulated_for_two_days_at_most", "[npc]" )
+{
+    clear_map();
+    calendar::turn = calendar::turn_zero;
+    rng_set_engine_seed( 7 );
+    npc offscreen = create_model();
+    rng_set_engine_seed( 7 );
+    npc loaded = create_model();
+    for( npc *guy : {
+             &offscreen, &loaded
+         } ) {
+        guy->set_fake( true );
+        guy->setpos( tripoint( 30, 30, 0 ) );
+        guy->last_updated = calendar::turn;
+    }
+
+    // However often the offscreen updates come, they stop after two days
+    rng_set_engine_seed( 11 );
+    for( ; calendar::turn < calendar::turn_zero + 5_days; calendar::turn += 5_minutes ) {
+        offscreen.update_offscreen();
+    }
+    CHECK( offscreen.last_updated > calendar::turn_zero + 1_days );
+    CHECK( offscreen.last_updated <= calendar::turn_zero + 2_days );
+
+    // Loading skips the rest, and ends up where loading the whole absence at once does
+    offscreen.on_load();
+    rng_set_engine_seed( 11 );
+    loaded.on_load();
+    CHECK( offscreen.last_updated == calendar::turn );
+    CHECK( loaded.last_updated == calendar::turn );
+    CHECK( offscreen.get_hunger() == loaded.get_hunger() );
+    CHECK( offscreen.get_thirst() == loaded.get_thirst() );
+    CHECK( offscreen.get_fatigue() == loaded.get_fatigue() );
+}
+
+TEST_CASE( "calm_npcs_rethink_when_something_happens", "[npc]" )
+{
+    calendar::turn = calendar::turn_zero + 12_hours + 1_turns;
+    clear_map();
+    g->place_player( tripoint( 10, 10, 0 ) );
+    // The same NPC for every section, the template rolls traits like bad eyesight
+    rng_set_engine_seed( 5 );
+    const character_id model_id = g->m.place_npc( point( 10, 10 ),
+                                  string_id<npc_template>( "test_talker" ), true );
+    g->load_npcs();
+    // Loading the NPC can bring in the surrounding map's spawns
+    clear_creatures();
+    npc *guy = g->find_npc( model_id );
+    REQUIRE( guy != nullptr );
+    guy->setpos( tripoint( 30, 30, 0 ) );
+    guy->set_attitude( NPCATT_NULL );
+    guy->set_mission( NPC_MISSION_GUARD );
+    guy->goal = guy->global_omt_location();
+    // Nothing to eat, drink or reload, whatever the template rolled
+    guy->inv.clear();
+    guy->remove_weapon();
+    guy->set_hunger( 0 );
+    guy->set_thirst( 0 );
+    guy->set_moves( 100 );
+    guy->move();
+    REQUIRE( guy->keeps_calm_decision() );
+
+    SECTION( "a hostile comes into view" ) {
+        spawn_test_monster( "mon_zombie", tripoint( 36, 30, 0 ) );
+        CHECK_FALSE( guy->keeps_calm_decision() );
+    }
+    SECTION( "the NPC gets hurt" ) {
+        guy->apply_damage( nullptr, bp_torso, 1 );
+        CHECK_FALSE( guy->keeps_calm_decision() );
+    }
+    SECTION( "the NPC is told to do something else" ) {
+        guy->set_attitude( NPCATT_FOLLOW );
+        CHECK_FALSE( guy->keeps_calm_decision() );
+    }
+    SECTION( "a fire starts nearby" ) {
+        g->m.add_field( guy->pos() + tripoint( 4, 0, 0 ), fd_fire, 1 );
+        CHECK_FALSE( guy->keeps_calm_decision() );
+    }
+    SECTION( "nothing happens for a while" ) {
+        calendar::turn += 30_turns;
+        CHECK_FALSE( guy->keeps_calm_decision() );
+    }
+    SECTION( "the NPC waits on the avatar" ) {
+        guy->set_attitude( NPCATT_WAIT_FOR_LEAVE );
+        guy->set_moves( 100 );
+        guy->move();
+        CHECK_FALSE( guy->keeps_calm_decision() );
+    }
+}
@@ -0,0 +1,274 @@
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "pathfinding.h"
+#include "simple_pathfinding.h"
+#include "type_id.h"
+#include "point.h"
+
+// Hidden benchmarks for map::route() and pf::find_path(), run with
+// `cata_test "[pathfinding_benchmark]"` before and after touching either.
+
+namespace
+{
+
+struct route_query {
+    tripoint from;
+    tripoint to;
+};
+
+struct route_profile {
+    const char *name;
+    pathfinding_settings settings;
+};
+
+} // namespace
+
+static const std::vector<route_profile> &route_profiles()
+{
+    static const std::vector<route_profile> profiles = {
+        { "walker", pathfinding_settings( 0, 1000, 1000, 0, true, false, true, false ) },
+        { "basher", pathfinding_settings( 40, 1000, 1000, 0, false, false, false, false ) },
+        { "avoid_rough", pathfinding_settings( 0, 1000, 1000, 0, true, false, false, true ) },
+    };
+    return profiles;
+}
+
+// Small deterministic generator so every run builds identical maps
+static unsigned next_random( unsigned &state )
+{
+    state = state * 1103515245u + 12345u;
+    return ( state >> 16 ) & 0x7fff;
+}
+
+static const tripoint bench_origin( 12, 12, 0 );
+static constexpr int bench_size = 100;
+
+static void fill_walls()
+{
+    const ter_id t_wall( "t_wall" );
+    for( int x = 0; x < bench_size; ++x ) {
+        for( int y = 0; y < bench_size; ++y ) {
+            g->m.ter_set( bench_origin + point( x, y ), t_wall );
+        }
+    }
+}
+
+static void build_open_field()
+{
+    clear_map();
+    const ter_id t_underbrush( "t_underbrush" );
+    unsigned state = 1;
+    for( int i = 0; i < bench_size * bench_size / 20; ++i ) {
+        const int x = next_random( state ) % bench_size;
+        const int y = next_random( state ) % bench_size;
+        g->m.ter_set( bench_origin + point( x, y ), t_underbrush );
+    }
+}
+
+// Recursive backtracker over odd cells, with a few extra openings so there are loops
+static void build_maze()
+{
+    clear_map();
+    fill_walls();
+    const ter_id t_dirt( "t_dirt" );
+    const int cells = ( bench_size - 1 ) / 2;
+    std::vector<bool> visited( cells * cells, false );
+    std::vector<point> stack = { point_zero };
+    visited[0] = true;
+    g->m.ter_set( bench_origin + point( 1, 1 ), t_dirt );
+    unsigned state = 7;
+    while( !stack.empty() ) {
+        const point cur = stack.back();
+        std::vector<point> next;
+        for( const point &d : four_adjacent_offsets ) {
+            const point p = cur + d;
+            if( p.x >= 0 && p.y >= 0 && p.x < cells && p.y < cells && !visited[p.x * cells + p.y] ) {
+                next.push_back( p );
+            }
+        }
+        if( next.empty() ) {
+            stack.pop_back();
+            continue;
+        }
+        const point p = next[next_random( state ) % next.size()];
+        visited[p.x * cells + p.y] = true;
+        g->m.ter_set( bench_origin + point( cur.x * 2 + 1 + p.x - cur.x, cur.y * 2 + 1 + p.y - cur.y ),
+                      t_dirt );
+        g->m.ter_set( bench_origin + point( p.x * 2 + 1, p.y * 2 + 1 ), t_dirt );
+        stack.push_back( p );
+    }
+    for( int i = 0; i < cells * 2; ++i ) {
+        const int x = 1 + next_random( state ) % ( bench_size - 2 );
+        const int y = 1 + next_random( state ) % ( bench_size - 2 );
+        g->m.ter_set( bench_origin + point( x, y ), t_dirt );
+    }
+}
+
+// Grid of 10x10 buildings with one door each, separated by streets
+static void build_city_blocks()
+{
+    clear_map();
+    const ter_id t_wall( "t_wall" );
+    const ter_id t_door_c( "t_door_c" );
+    const ter_id t_floor( "t_floor" );
+    for( int bx = 0; bx + 10 <= bench_size; bx += 14 ) {
+        for( int by = 0; by + 10 <= bench_size; by += 14 ) {
+            for( int x = 0; x < 10; ++x ) {
+                for( int y = 0; y < 10; ++y ) {
+                    const bool edge = x == 0 || y == 0 || x == 9 || y == 9;
+                    g->m.ter_set( bench_origin + point( bx + x, by + y ), edge ? t_wall : t_floor );
+                }
+            }
+            const point door = ( bx / 14 + by / 14 ) % 2 == 0 ? point( 5, 0 ) : point( 0, 5 );
+            g->m.ter_set( bench_origin + point( bx, by ) + door, t_door_c );
+        }
+    }
+}
+
+static void build_parking_lot()
+{
+    clear_map();
+    for( int x = 4; x + 8 < bench_size; x += 12 ) {
+        for( int y = 4; y + 8 < bench_size; y += 10 ) {
+            g->m.add_vehicle( vproto_id( "car" ), bench_origin + point( x, y ), 0, 0, 0 );
+        }
+    }
+}
+
+static std::vector<route_query> corner_to_corner_queries()
+{
+    std::vector<route_query> queries;
+    unsigned state = 3;
+    for( int i = 0; i < 20; ++i ) {
+        const int x0 = 1 + 2 * ( next_random( state ) % 10 );
+        const int y0 = 1 + 2 * ( next_random( state ) % 10 );
+        const int x1 = bench_size - 2 - 2 * ( next_random( state ) % 10 );
+        const int y1 = bench_size - 2 - 2 * ( next_random( state ) % 10 );
+        queries.push_back( { bench_origin + point( x0, y0 ), bench_origin + point( x1, y1 ) } );
+    }
+    return queries;
+}
+
+static void run_route_benchmark( const char *scenario, const std::function<void()> &build,
+                                 const std::vector<route_query> &queries )
+{
+    build();
+    for( const route_profile &profile : route_profiles() ) {
+        const pathfinding_stats before = get_pathfinding_stats();
+        int found = 0;
+        const auto start = std::chrono::high_resolution_clock::now();
+        for( const route_query &q : queries ) {
+            if( !g->m.route( q.from, q.to, profile.settings ).empty() ) {
+                found++;
+            }
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+        const long long micros = std::chrono::duration_cast<std::chrono::microseconds>
+                                 ( end - start ).count();
+        const long long count = queries.size();
+#if defined(RELEASE)
+        // Release builds don't count the work done
+        static_cast<void>( before );
+        WARN( scenario << " / " << profile.name << ": " << found << "/" << count << " found, " <<
+              micros / count << " us/route" );
+#else
+        const pathfinding_stats &after = get_pathfinding_stats();
+        WARN( scenario << " / " << profile.name << ": " << found << "/" << count << " found, " <<
+              micros / count << " us/route, " <<
+              ( after.expanded - before.expanded ) / count << " expanded, " <<
+              ( after.pushed - before.pushed ) / count << " pushed, " <<
+              ( after.layers_allocated - before.layers_allocated ) / count << " layers per route" );
+#endif
+    }
+}
+
+TEST_CASE( "route_benchmark_open_field", "[.][pathfinding_benchmark]" )
+{
+    run_route_benchmark( "open field", build_open_field, corner_to_corner_queries() );
+}
+
+TEST_CASE( "route_benchmark_maze", "[.][pathfinding_benchmark]" )
+{
+    run_route_benchmark( "maze", build_maze, corner_to_corner_queries() );
+}
+
+TEST_CASE( "route_benchmark_city_blocks", "[.][pathfinding_benchmark]" )
+{
+    std::vector<route_query> queries;
+    // From street corners into the middle of each building
+    for( int bx = 0; bx + 10 <= bench_size; bx += 14 ) {
+        for( int by = 0; by + 10 <= bench_size; by += 14 ) {
+            queries.push_back( { bench_origin + point( bench_size - 1 - by, 11 + bx / 2 ),
+                                 bench_origin + point( bx + 5, by + 5 )
+                               } );
+        }
+    }
+    run_route_benchmark( "city blocks", build_city_blocks, queries );
+}
+
+TEST_CASE( "route_benchmark_unreachable", "[.][pathfinding_benchmark]" )
+{
+    std::vector<route_query> queries;
+    for( int i = 0; i < 10; ++i ) {
+        queries.push_back( { bench_origin + point( i, 0 ), bench_origin + point( bench_size / 2, bench_size / 2 ) } );
+    }
+    run_route_benchmark( "unreachable", [] {
+        build_open_field();
+        const ter_id t_wall( "t_wall" );
+        for( const tripoint &p : g->m.points_in_radius( bench_origin + point( bench_size / 2, bench_size / 2 ), 1 ) )
+        {
+            if( p != bench_origin + point( bench_size / 2, bench_size / 2 ) ) {
+                g->m.ter_set( p, t_wall );
+            }
+        }
+    }, queries );
+}
+
+TEST_CASE( "route_benchmark_parking_lot", "[.][pathfinding_benchmark]" )
+{
+    run_route_benchmark( "parking lot", build_parking_lot, corner_to_corner_queries() );
+}
+
+TEST_CASE( "simple_pathfinding_benchmark", "[.][pathfinding_benchmark]" )
+{
+    // Overmap-sized grid with scattered obstacles, like overmap road and river placement
+    static constexpr int size = 180;
+    std::vector<bool> blocked( size * size, false );
+    unsigned state = 11;
+    for( int i = 0; i < size * size / 4; ++i ) {
+        blocked[next_random( state ) % ( size * size )] = true;
+    }
+    const auto estimate = [&]( const pf::node & cur, const pf::node * ) {
+        if( blocked[cur.pos.x * size + cur.pos.y] ) {
+            return pf::rejected;
+        }
+        return std::abs( cur.pos.x - ( size - 1 ) ) + std::abs( cur.pos.y - ( size - 1 ) );
+    };
+    blocked[0] = false;
+    blocked[size * size - 1] = false;
+
+    static constexpr int runs = 50;
+    long long expanded = 0;
+    size_t found = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < runs; ++i ) {
+        const pf::path path = pf::find_path( point_zero, point( size - 1, size - 1 ), size, size,
+                                             estimate );
+        found += path.nodes.empty() ? 0 : 1;
+        expanded += pf::get_search_buffers().expanded;
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long long micros = std::chrono::duration_cast<std::chrono::microseconds>
+                             ( end - start ).count();
+    WARN( "pf::find_path " << found << "/" << runs << " found, " << micros / runs << " us/path, " <<
+          expanded / runs << " expanded per path" );
+}
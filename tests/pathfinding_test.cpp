@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "cata_utility.h"
+#include "game.h"
+#include "line.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "pathfinding.h"
+#include "type_id.h"
+#include "game_constants.h"
+#include "point.h"
+
+namespace
+{
+
+struct route_setup {
+    tripoint from;
+    tripoint to;
+};
+
+} // namespace
+
+// '#' is a wall, ',' is slow underbrush, 'f' and 't' mark the route ends, anything else is grass
+static route_setup build_layout( const std::vector<std::string> &layout )
+{
+    const ter_id t_wall( "t_wall" );
+    const ter_id t_underbrush( "t_underbrush" );
+    const tripoint origin( 40, 40, 0 );
+    clear_map();
+
+    route_setup ret;
+    for( size_t y = 0; y < layout.size(); ++y ) {
+        for( size_t x = 0; x < layout[y].size(); ++x ) {
+            const tripoint p = origin + point( x, y );
+            switch( layout[y][x] ) {
+                case '#':
+                    g->m.ter_set( p, t_wall );
+                    break;
+                case ',':
+                    g->m.ter_set( p, t_underbrush );
+                    break;
+                case 'f':
+                    ret.from = p;
+                    break;
+                case 't':
+                    ret.to = p;
+                    break;
+            }
+        }
+    }
+    return ret;
+}
+
+// Cost the pathfinder assigns to stepping from `from` to the adjacent tile `to`
+static int step_cost( const tripoint &from, const tripoint &to )
+{
+    const int cost = g->m.move_cost( to );
+    if( cost <= 0 ) {
+        return -1;
+    }
+    return cost + ( ( from.x != to.x && from.y != to.y ) ? 1 : 0 );
+}
+
+// Plain Dijkstra over the whole z-level, as a reference for the optimal route cost
+static int reference_cost( const tripoint &from, const tripoint &to )
+{
+    const int size = g->m.getmapsize() * SEEX;
+    std::vector<int> dist( size * size, std::numeric_limits<int>::max() );
+    using entry = std::pair<int, tripoint>;
+    std::priority_queue<entry, std::vector<entry>, pair_greater_cmp_first> open;
+    dist[from.x * size + from.y] = 0;
+    open.emplace( 0, from );
+    while( !open.empty() ) {
+        const entry cur = open.top();
+        open.pop();
+        if( cur.second == to ) {
+            return cur.first;
+        }
+        if( cur.first > dist[cur.second.x * size + cur.second.y] ) {
+            continue;
+        }
+        for( const tripoint &p : g->m.points_in_radius( cur.second, 1 ) ) {
+            const int cost = step_cost( cur.second, p );
+            if( p == cur.second || cost < 0 ) {
+                continue;
+            }
+            int &d = dist[p.x * size + p.y];
+            if( cur.first + cost < d ) {
+                d = cur.first + cost;
+                open.emplace( d, p );
+            }
+        }
+    }
+    return -1;
+}
+
+static void check_route_is_optimal( const std::vector<std::string> &layout )
+{
+    const route_setup setup = build_layout( layout );
+    const pathfinding_settings settings( 0, 100, 1000, 0, false, false, false, false );
+    const std::vector<tripoint> route = g->m.route( setup.from, setup.to, settings );
+    REQUIRE( !route.empty() );
+    CHECK( route.back() == setup.to );
+
+    int cost = 0;
+    tripoint prev = setup.from;
+    for( const tripoint &p : route ) {
+        INFO( "step " << prev.to_string() << " -> " << p.to_string() );
+        REQUIRE( square_dist( prev, p ) == 1 );
+        const int step = step_cost( prev, p );
+        REQUIRE( step > 0 );
+        cost += step;
+        prev = p;
+    }
+    CHECK( cost == reference_cost( setup.from, setup.to ) );
+}
+
+TEST_CASE( "route_around_single_wall_is_optimal", "[pathfinding]" )
+{
+    check_route_is_optimal( {
+        "                          ",
+        "            #             ",
+        "            #             ",
+        "  f         #         t   ",
+        "            #             ",
+        "            #             ",
+        "                          ",
+    } );
+}
+
+TEST_CASE( "route_through_walled_corridors_is_optimal", "[pathfinding]" )
+{
+    check_route_is_optimal( {
+        "                                ",
+        "  ##########################    ",
+        "           #            #       ",
+        "  f        #     #      #    t  ",
+        "           #     #      #       ",
+        "  ######## #     #####  ######  ",
+        "                 #              ",
+        "                 #              ",
+    } );
+}
+
+TEST_CASE( "route_across_mixed_terrain_is_optimal", "[pathfinding]" )
+{
+    check_route_is_optimal( {
+        "                              ",
+        "   ,,,,,     #                ",
+        "   ,,,,,     #     ,,,,,,,    ",
+        " f ,,,,,     #     ,,,,,,,  t ",
+        "   ,,,,,     #     ,,,,,,,    ",
+        "   ,,,,,    ,,,    ,,,,,,,    ",
+        "            ,,,               ",
+    } );
+}
+
+TEST_CASE( "route_diagonally_past_pillars_is_optimal", "[pathfinding]" )
+{
+    check_route_is_optimal( {
+        "f                          ",
+        "     #     #     #     #   ",
+        "   #     #     #     #     ",
+        "     #     #     #     #   ",
+        "   #     #     #     #     ",
+        "     #     #     #     #   ",
+        "   #     #     #     #     ",
+        "                          t",
+    } );
+}
+
+TEST_CASE( "route_to_enclosed_target_is_empty", "[pathfinding]" )
+{
+    const route_setup setup = build_layout( {
+        "              ",
+        "         ###  ",
+        "  f      #t#  ",
+        "         ###  ",
+        "              ",
+    } );
+    const pathfinding_settings settings( 0, 100, 1000, 0, false, false, false, false );
+    CHECK( g->m.route( setup.from, setup.to, settings ).empty() );
+}
+
+TEST_CASE( "route_into_pocket_needs_an_opening", "[pathfinding]" )
+{
+    const std::vector<std::string> layout = {
+        "                                        ",
+        "                               #####    ",
+        "  f                            #   #    ",
+        "                               # t #    ",
+        "                               #   #    ",
+        "                               ## ##    ",
+        "                                        ",
+    };
+    const pathfinding_settings settings( 0, 100, 1000, 0, false, false, false, false );
+
+    GIVEN( "a pocket with a gap in its wall" ) {
+        const route_setup setup = build_layout( layout );
+        THEN( "the target is reachable" ) {
+            const std::vector<tripoint> route = g->m.route( setup.from, setup.to, settings );
+            REQUIRE( !route.empty() );
+            CHECK( route.back() == setup.to );
+        }
+        WHEN( "the gap is closed off for the route" ) {
+            const std::set<tripoint> avoid = { setup.to + point( 0, 2 ) };
+            THEN( "the target is unreachable" ) {
+                CHECK( g->m.route( setup.from, setup.to, settings, avoid ).empty() );
+            }
+        }
+        WHEN( "the gap is walled up" ) {
+            g->m.ter_set( setup.to + point( 0, 2 ), ter_id( "t_wall" ) );
+            THEN( "the target is unreachable" ) {
+                CHECK( g->m.route( setup.from, setup.to, settings ).empty() );
+            }
+        }
+    }
+}
+
+TEST_CASE( "routes_to_several_targets_in_one_search", "[pathfinding]" )
+{
+    const route_setup setup = build_layout( {
+        "                                        ",
+        "          #                    #####    ",
+        "  f       #                    #   #    ",
+        "          #                    #   #    ",
+        "          #                    #####    ",
+        "                                        ",
+    } );
+    const tripoint origin = setup.from - point( 2, 2 );
+    const tripoint behind_wall = origin + point( 12, 2 );
+    const tripoint far_away = origin + point( 25, 5 );
+    const tripoint walled_in = origin + point( 33, 2 );
+    const std::vector<tripoint> targets = { walled_in, far_away, behind_wall };
+    const pathfinding_settings settings( 0, 100, 1000, 0, false, false, false, false );
+
+    const std::vector<std::vector<tripoint>> all = g->m.routes( setup.from, targets, settings );
+    REQUIRE( all.size() == 2 );
+    CHECK( all[0].back() == behind_wall );
+    CHECK( all[1].back() == far_away );
+    for( const std::vector<tripoint> &route : all ) {
+        int cost = 0;
+        tripoint prev = setup.from;
+        for( const tripoint &p : route ) {
+            REQUIRE( square_dist( prev, p ) == 1 );
+            cost += step_cost( prev, p );
+            prev = p;
+        }
+        CHECK( cost == reference_cost( setup.from, route.back() ) );
+    }
+
+    const std::vector<std::vector<tripoint>> nearest = g->m.routes( setup.from, targets, settings, 1 );
+    REQUIRE( nearest.size() == 1 );
+    CHECK( nearest[0] == all[0] );
+}
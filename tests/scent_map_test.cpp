@@ -0,0 +1,141 @@
+#include <cstdlib>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "scent_map.h"
+#include "type_id.h"
+#include "game_constants.h"
+#include "point.h"
+
+// Straightforward 3x3 diffusion with the same integer arithmetic as scent_map::update,
+// one square at a time, to check the optimized version against.
+static std::vector<std::vector<int>> reference_diffusion( const std::vector<std::vector<int>>
+                                  &before, const tripoint &center, const int radius )
+{
+    const int diffusivity = 100;
+    const auto blocks = [&]( int x, int y ) {
+        return g->m.has_flag_ter( TFLAG_WALL, tripoint( x, y, center.z ) );
+    };
+    const auto reduces = [&]( int x, int y ) {
+        return g->m.has_flag_ter_or_furn( TFLAG_REDUCE_SCENT, tripoint( x, y, center.z ) );
+    };
+    std::vector<std::vector<int>> after = before;
+    for( int x = center.x - radius; x <= center.x + radius; ++x ) {
+        for( int y = center.y - radius; y <= center.y + radius; ++y ) {
+            if( blocks( x, y ) ) {
+                after[x][y] = 0;
+                continue;
+            }
+            int squares_used = 0;
+            int sum = 0;
+            for( int i = x - 1; i <= x + 1; ++i ) {
+                for( int j = y - 1; j <= y + 1; ++j ) {
+                    if( blocks( i, j ) ) {
+                        continue;
+                    }
+                    const int weight = reduces( i, j ) ? 2 : 10;
+                    squares_used += weight;
+                    sum += weight * before[i][j];
+                }
+            }
+            const int this_diffusivity = reduces( x, y ) ? diffusivity / 5 : diffusivity;
+            int temp_scent = before[x][y] * ( 10 * 1000 - squares_used * this_diffusivity );
+            temp_scent -= before[x][y] * this_diffusivity * ( 90 - squares_used ) / 5;
+            after[x][y] = ( temp_scent + this_diffusivity * sum ) / ( 1000 * 10 );
+        }
+    }
+    return after;
+}
+
+TEST_CASE( "scent_diffusion_matches_reference", "[scent]" )
+{
+    clear_map();
+    const tripoint center( 65, 65, 0 );
+    const int radius = 40;
+    // A room with a doorway, and some tents that let less scent through
+    for( int i = 0; i < 20; ++i ) {
+        g->m.ter_set( center + point( i - 10, -10 ), ter_id( "t_wall" ) );
+        g->m.ter_set( center + point( i - 10, 10 ), ter_id( "t_wall" ) );
+        g->m.ter_set( center + point( -10, i - 10 ), ter_id( "t_wall" ) );
+        if( i != 5 ) {
+            g->m.ter_set( center + point( 10, i - 10 ), ter_id( "t_wall" ) );
+        }
+        g->m.ter_set( center + point( 15 + i % 3, i ), ter_id( "t_tarptent" ) );
+    }
+
+    scent_map scent( *g );
+    std::vector<std::vector<int>> values( MAPSIZE_X, std::vector<int>( MAPSIZE_Y, 0 ) );
+    // Leave big parts of the window without scent
+    for( int x = center.x - 15; x <= center.x + 25; ++x ) {
+        for( int y = center.y - 12; y <= center.y + 20; ++y ) {
+            values[x][y] = ( x * 7 + y * 13 ) % 500;
+            scent.set( tripoint( x, y, center.z ), values[x][y] );
+        }
+    }
+
+    for( int turn = 0; turn < 3; ++turn ) {
+        values = reference_diffusion( values, center, radius );
+        scent.update( center, g->m );
+        for( int x = 0; x < MAPSIZE_X; ++x ) {
+            for( int y = 0; y < MAPSIZE_Y; ++y ) {
+                INFO( "turn " << turn << " at " << x << "," << y );
+                REQUIRE( std::max( values[x][y], 0 ) == scent.get( tripoint( x, y, center.z ) ) );
+            }
+        }
+    }
+
+    SECTION( "terrain changes reach the cached scent flags" ) {
+        g->m.ter_set( center + point( 10, -5 ), ter_id( "t_wall" ) );
+        values = reference_diffusion( values, center, radius );
+        scent.update( center, g->m );
+        CHECK( scent.get( center + point( 10, -5 ) ) == 0 );
+        CHECK( scent.get( center + point( 1, 1 ) ) == values[center.x + 1][center.y + 1] );
+    }
+}
+
+TEST_CASE( "npc_scent_diffuses_separately", "[scent]" )
+{
+    clear_map();
+    const tripoint center( 65, 65, 0 );
+    scent_map scent( *g );
+
+    scent.set( center, 301, scent_type::npc );
+    CHECK( scent.get( center, scent_type::npc ) == 300 );
+    CHECK( scent.get( center ) == 0 );
+    scent.set( center + point( 5, 0 ), 2000, scent_type::npc );
+    CHECK( scent.get( center + point( 5, 0 ), scent_type::npc ) == 510 );
+
+    scent.set( center + point( -5, 0 ), 300 );
+    scent.update( center, g->m );
+    // Both channels spread the same way, at the npc channel's resolution
+    CHECK( scent.get( center + point( 1, 0 ), scent_type::npc ) > 0 );
+    CHECK( scent.get( center + point( -4, 0 ) ) > 0 );
+    CHECK( std::abs( scent.get( center + point( 1, 1 ), scent_type::npc ) -
+                     scent.get( center + point( -4, 1 ) ) ) <= 2 );
+    CHECK( scent.get( center + point( 2, 0 ), scent_type::npc ) == 0 );
+
+    scent.decay();
+    scent.reset();
+    CHECK( scent.get( center, scent_type::npc ) == 0 );
+}
+
+TEST_CASE( "scent_channels_fade_at_the_same_rate", "[scent]" )
+{
+    clear_map();
+    const tripoint center( 65, 65, 0 );
+    scent_map scent( *g );
+    scent.set( center, 300 );
+    scent.set( center, 300, scent_type::npc );
+    for( int turn = 1; turn <= 20; ++turn ) {
+        scent.decay();
+        INFO( "turn " << turn );
+        // The npc channel only stores every other value
+        CHECK( std::abs( scent.get( center ) - scent.get( center, scent_type::npc ) ) <= 1 );
+    }
+    CHECK( scent.get( center ) == 280 );
+    CHECK( scent.get( center, scent_type::npc ) == 280 );
+}
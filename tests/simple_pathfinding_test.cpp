@@ -0,0 +1,85 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "simple_pathfinding.h"
+#include "point.h"
+
+static pf::path path_through( const std::vector<std::string> &grid, const point &from,
+                              const point &to )
+{
+    const int width = grid[0].size();
+    const int height = grid.size();
+    const auto estimate = [&]( const pf::node & cur, const pf::node * ) {
+        if( grid[cur.pos.y][cur.pos.x] == '#' ) {
+            return pf::rejected;
+        }
+        return std::abs( to.x - cur.pos.x ) + std::abs( to.y - cur.pos.y );
+    };
+    return pf::find_path( from, to, width, height, estimate );
+}
+
+TEST_CASE( "simple_pathfinding_goes_around_walls", "[pathfinding]" )
+{
+    const std::vector<std::string> grid = {
+        "          ",
+        " ######## ",
+        "        # ",
+        " ###### # ",
+        "        # ",
+    };
+    const point from( 0, 4 );
+    const point to( 9, 4 );
+    const pf::path res = path_through( grid, from, to );
+    REQUIRE( !res.nodes.empty() );
+    // Nodes run from the destination back to the source
+    CHECK( res.nodes.front().pos == to );
+    CHECK( res.nodes.back().pos == from );
+    for( size_t i = 1; i < res.nodes.size(); i++ ) {
+        const point &a = res.nodes[i - 1].pos;
+        const point &b = res.nodes[i].pos;
+        CHECK( std::abs( a.x - b.x ) + std::abs( a.y - b.y ) == 1 );
+        CHECK( grid[b.y][b.x] != '#' );
+    }
+}
+
+TEST_CASE( "simple_pathfinding_reuses_buffers_between_searches", "[pathfinding]" )
+{
+    const std::vector<std::string> walled = {
+        "     ",
+        "#### ",
+        "   # ",
+        "#### ",
+        "     ",
+    };
+    const std::vector<std::string> open = {
+        "   ",
+        "   ",
+        "   ",
+    };
+    // The enclosed tile can't be reached, and a failed search must not leak into the next one
+    CHECK( path_through( walled, point( 0, 0 ), point( 0, 2 ) ).nodes.empty() );
+    CHECK( path_through( open, point( 0, 0 ), point( 2, 2 ) ).nodes.size() == 5 );
+    CHECK( path_through( walled, point( 0, 0 ), point( 0, 4 ) ).nodes.size() == 13 );
+}
+
+TEST_CASE( "simple_pathfinding_allows_nested_searches", "[pathfinding]" )
+{
+    const std::vector<std::string> grid = {
+        "     ",
+        " ### ",
+        "     ",
+    };
+    const pf::path outer = pf::find_path( point_zero, point( 4, 2 ), 5, 3,
+    [&]( const pf::node & cur, const pf::node * ) {
+        if( grid[cur.pos.y][cur.pos.x] == '#' ) {
+            return pf::rejected;
+        }
+        // Estimating by the length of another search must not disturb this one
+        const pf::path inner = path_through( grid, cur.pos, point( 4, 2 ) );
+        return static_cast<int>( inner.nodes.size() );
+    } );
+    CHECK( outer.nodes.size() == 7 );
+    CHECK( path_through( grid, point( 4, 2 ), point_zero ).nodes.size() == 7 );
+}
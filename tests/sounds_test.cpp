@@ -0,0 +1,22 @@
+#include "catch/catch.hpp"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "sounds.h"
+#include "type_id.h"
+#include "point.h"
+
+TEST_CASE( "sounds_are_muffled_by_walls", "[sounds]" )
+{
+    clear_map();
+    const tripoint source( 40, 40, 0 );
+    const tripoint listener = source + point( 10, 0 );
+    g->m.build_map_cache( 0, true );
+    CHECK( sounds::attenuated_volume( source, listener, 50 ) == 50 );
+
+    g->m.ter_set( source + point( 4, 0 ), ter_id( "t_wall" ) );
+    g->m.ter_set( source + point( 6, 0 ), ter_id( "t_wall" ) );
+    g->m.build_map_cache( 0, true );
+    CHECK( sounds::attenuated_volume( source, listener, 50 ) == 30 );
+    CHECK( sounds::attenuated_volume( source, listener, 15 ) == 0 );
+}